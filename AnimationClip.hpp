@@ -0,0 +1,81 @@
+#ifndef ANIMATIONCLIP_H_
+#define ANIMATIONCLIP_H_
+
+#include "Sprite.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief The image shown during one frame of an AnimationClip.
+     * @sharedapi
+     */
+    struct AnimationFrame {
+        std::uint32_t texture; // Texture ID, interned by the TextureCache
+        bool flipX; // Whether the image is flipped on the X-axis
+        bool flipY; // Whether the image is flipped on the Y-axis
+    };
+
+    /**
+     * @brief An immutable sequence of frames with its timing, shared by every Animator playing it.
+     * @details A clip only holds frame data. Every Animator applies the current frame to its
+     *          own Sprite, so color, sorting and owner stay per instance.
+     * @sharedapi
+     */
+    class AnimationClip {
+        public:
+            /**
+             * @brief Constructor.
+             * @param fps The amount of frames per second the clip is played at.
+             * @param frames The frames to cycle through.
+             * @exception A std::invalid_argument is thrown when fps is not positive or frames is empty.
+             * @sharedapi
+             */
+            AnimationClip(int fps, std::vector<AnimationFrame> frames);
+
+            /**
+             * @brief Constructor, taking the texture and flips of every sprite as a frame.
+             * @param fps The amount of frames per second the clip is played at.
+             * @param sprites The sprites to take the frames from. They are not kept.
+             * @exception A std::invalid_argument is thrown when fps is not positive or sprites is empty.
+             * @sharedapi
+             */
+            AnimationClip(int fps, const std::vector<std::shared_ptr<Sprite>>& sprites);
+
+            /**
+             * @brief The amount of frames per second the clip is played at by default.
+             * @sharedapi
+             */
+            int FPS() const { return fps; }
+
+            /**
+             * @brief The amount of frames in the clip.
+             * @sharedapi
+             */
+            std::size_t FrameCount() const { return frames.size(); }
+
+            /**
+             * @brief Get one frame of the clip.
+             * @param index The index of the frame, 0 ≤ index < FrameCount().
+             * @return The frame data.
+             * @sharedapi
+             */
+            const AnimationFrame& Frame(std::size_t index) const { return frames.at(index); }
+
+            /**
+             * @brief All frames of the clip.
+             * @sharedapi
+             */
+            const std::vector<AnimationFrame>& Frames() const { return frames; }
+
+        private:
+            int fps;
+            std::vector<AnimationFrame> frames;
+    };
+
+}
+
+#endif // ANIMATIONCLIP_H_
@@ -0,0 +1,98 @@
+#ifndef ANIMATIONSYSTEM_H_
+#define ANIMATIONSYSTEM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if __has_include("AnimationSystem_includes.hpp")
+#include "AnimationSystem_includes.hpp"
+#endif
+
+namespace spic {
+
+    class Animator;
+
+    /**
+     * @brief Advances all playing Animators at once.
+     * @details The state of the playing animators is stored as parallel arrays, so one
+     *          update is a single loop computing the frame index of every animator from its
+     *          start time, FPS and frame count. When the frame index of an animator changes,
+     *          the frame is applied to the sprite of that animator.
+     * @sharedapi
+     */
+    class AnimationSystem {
+        private:
+            static AnimationSystem instance;
+            AnimationSystem();
+
+            double time;
+            std::vector<Animator*> animators;
+            std::vector<double> startTimes;
+            std::vector<int> fps;
+            std::vector<std::size_t> frameCounts;
+            std::vector<std::uint8_t> looping;
+            std::vector<std::size_t> frames;
+
+#if __has_include("AnimationSystem_private.hpp")
+#include "AnimationSystem_private.hpp"
+#endif
+
+        public:
+            static AnimationSystem& Instance();
+            AnimationSystem(const AnimationSystem&) = delete;
+            AnimationSystem& operator=(const AnimationSystem&) = delete;
+            AnimationSystem(const AnimationSystem&&) = delete;
+            AnimationSystem& operator=(AnimationSystem&&) = delete;
+
+            /**
+             * @brief Start advancing an animator, called by Animator::Play().
+             * @param animator The animator to start. Its animation starts at the current time.
+             * @param looping If true, the animation starts again when done.
+             * @sharedapi
+             */
+            void Register(Animator& animator, bool looping);
+
+            /**
+             * @brief Stop advancing an animator, called by Animator::Stop() and ~Animator().
+             * @param animator The animator to stop.
+             * @sharedapi
+             */
+            void Unregister(Animator& animator);
+
+            /**
+             * @brief Change the FPS of a playing animator, called by Animator::FPS().
+             * @details The start time is shifted so the animator continues from its current frame.
+             *          Does nothing when the animator is not playing.
+             * @param animator The animator to change.
+             * @param fps The new amount of frames per second, greater than 0.
+             * @sharedapi
+             */
+            void Rate(Animator& animator, int fps);
+
+            /**
+             * @brief Advance the clock and update the frame of every playing animator.
+             * @details Called by the engine once per frame. Animators which are not looping
+             *          stop on their last frame.
+             * @param deltaTime The scaled time since the last update, in seconds.
+             * @sharedapi
+             */
+            void Update(double deltaTime);
+
+            /**
+             * @brief The time the animation clock has advanced since the engine started.
+             * @return The time in seconds
+             * @sharedapi
+             */
+            double Time() const { return time; }
+
+            /**
+             * @brief The amount of animators being advanced.
+             * @sharedapi
+             */
+            std::size_t PlayingCount() const { return animators.size(); }
+    };
+
+}
+
+#endif // ANIMATIONSYSTEM_H_
@@ -1,8 +1,10 @@
 #ifndef ANIMATOR_H_
 #define ANIMATOR_H_
 
+#include "AnimationClip.hpp"
 #include "Component.hpp"
 #include "Sprite.hpp"
+#include <cstddef>
 #include <vector>
 #include <memory>
 
@@ -20,14 +22,42 @@ namespace spic {
         public:
             /**
              * @brief Constructor.
+             * @details Creates a clip which is only used by this animator, and shows it on a
+             *          copy of the first sprite. The copy is added to the GameObject the animator
+             *          is added to, so it is drawn like before. Prefer sharing one AnimationClip
+             *          between animators playing the same sprites.
              * @param fps The amount of frames the animator will cycle though per second.
              * @param sprites An list of sprites to loop through.
+             * @exception A std::invalid_argument is thrown when sprites is empty.
              * @sharedapi
              */
-            Animator(int fps, const std::vector<std::shared_ptr<Sprite>>& sprites);
+            Animator(int fps, const std::vector<std::shared_ptr<spic::Sprite>>& sprites);
+
+            /**
+             * @brief Constructor.
+             * @param clip The clip to play, at the FPS of the clip.
+             * @param sprite The sprite to show the clip on. Its texture and flips are set from
+             *        the current frame; it must not be shared with other animators. When it is
+             *        not on a GameObject yet, it is added to the GameObject the animator is added to.
+             * @exception A std::invalid_argument is thrown when clip or sprite is null.
+             * @sharedapi
+             */
+            Animator(std::shared_ptr<const AnimationClip> clip, std::shared_ptr<spic::Sprite> sprite);
+
+            /**
+             * @brief Destructor. Unregisters the animator from the AnimationSystem when playing.
+             * @sharedapi
+             */
+            ~Animator() override;
+
+            Animator(const Animator&) = delete;
+            Animator& operator=(const Animator&) = delete;
+            Animator(Animator&&) = delete;
+            Animator& operator=(Animator&&) = delete;
 
             /**
              * @brief Start playing the image sequence.
+             * @details Registers the animator with the AnimationSystem, which advances it from then on.
              * @param looping If true, will automatically start again when done.
              * @spicapi
              */
@@ -49,11 +79,49 @@ namespace spic {
 
             /**
              * @brief Set the new frames per second of the animator
+             * @details When playing, the new rate is passed to the AnimationSystem and applies
+             *          from the current frame on.
              * @param newFps An integer representing the new frames per second of the animator
+             * @exception A std::invalid_argument is thrown when newFps is not positive.
              * @sharedapi
              */
             void FPS(int newFps);
 
+            /**
+             * @brief Get the clip played by the animator
+             * @return A shared pointer to the clip
+             * @sharedapi
+             */
+            const std::shared_ptr<const AnimationClip>& Clip() const { return clip; }
+
+            /**
+             * @brief Set the clip played by the animator, restarting it when playing
+             * @param newClip The clip to play
+             * @sharedapi
+             */
+            void Clip(std::shared_ptr<const AnimationClip> newClip);
+
+            /**
+             * @brief Get the sprite the animator shows its clip on
+             * @return A shared pointer to the sprite, owned by this animator
+             * @sharedapi
+             */
+            const std::shared_ptr<spic::Sprite>& Sprite() const { return sprite; }
+
+            /**
+             * @brief Get the index of the frame currently shown, as computed by the AnimationSystem
+             * @return The index of the frame in the clip
+             * @sharedapi
+             */
+            std::size_t CurrentFrame() const;
+
+            /**
+             * @brief Get if the animator is playing
+             * @return true if playing, false otherwise
+             * @sharedapi
+             */
+            bool Playing() const;
+
 #if __has_include("Animator_public.hpp")
 #include "Animator_public.hpp"
 #endif
@@ -65,6 +133,18 @@ namespace spic {
              */
             int fps;
 
+            /**
+             * @brief the frames and their default timing
+             * @sharedapi
+             */
+            std::shared_ptr<const AnimationClip> clip;
+
+            /**
+             * @brief the sprite the current frame is applied to
+             * @sharedapi
+             */
+            std::shared_ptr<spic::Sprite> sprite;
+
 #if __has_include("Animator_private.hpp")
 #include "Animator_private.hpp"
 #endif
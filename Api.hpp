@@ -1,6 +1,14 @@
+#include "AnimationClip.hpp"
+#include "AnimationSystem.hpp"
 #include "Animator.hpp"
+#include "AudioClip.hpp"
+#include "AudioClipCache.hpp"
+#include "AudioConfig.hpp"
+#include "AudioMixer.hpp"
 #include "AudioSource.hpp"
+#include "AudioStream.hpp"
 #include "BehaviourScript.hpp"
+#include "Bounds.hpp"
 #include "BoxCollider.hpp"
 #include "Button.hpp"
 #include "Camera.hpp"
@@ -9,18 +17,37 @@
 #include "Color.hpp"
 #include "Component.hpp"
 #include "Debug.hpp"
+#include "DrawList.hpp"
 #include "Engine.hpp"
 #include "EngineConfig.hpp"
+#include "Framebuffer.hpp"
 #include "GameObject.hpp"
+#include "GlyphCache.hpp"
 #include "IKeyListener.hpp"
 #include "IMouseListener.hpp"
 #include "Input.hpp"
+#include "JobSystem.hpp"
+#include "ParticleEmitter.hpp"
+#include "Physics.hpp"
 #include "Point.hpp"
+#include "RenderConfig.hpp"
+#include "RenderQueue.hpp"
+#include "RenderStats.hpp"
+#include "Renderer.hpp"
 #include "RigidBody.hpp"
 #include "Scene.hpp"
+#include "Span.hpp"
+#include "SpatialGrid.hpp"
+#include "SpscQueue.hpp"
 #include "Sprite.hpp"
 #include "Text.hpp"
+#include "TextLayoutCache.hpp"
+#include "Texture.hpp"
+#include "TextureAtlas.hpp"
+#include "TextureCache.hpp"
+#include "Tilemap.hpp"
 #include "Time.hpp"
 #include "Transform.hpp"
+#include "UILayout.hpp"
 #include "UIObject.hpp"
 #include "WindowConfig.hpp"
@@ -0,0 +1,94 @@
+#ifndef AUDIOCLIP_H_
+#define AUDIOCLIP_H_
+
+#include "Span.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#if __has_include("AudioClip_includes.hpp")
+#include "AudioClip_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief A loaded audio file, shared by every AudioSource playing the same path.
+     * @details Short clips are decoded fully into memory. Clips larger than the streaming
+     *          threshold of the AudioConfig only keep their format, and are decoded while
+     *          playing by an AudioStream.
+     * @sharedapi
+     */
+    class AudioClip {
+        public:
+            /**
+             * @brief The path the clip was loaded from.
+             * @sharedapi
+             */
+            const std::string& Path() const { return path; }
+
+            /**
+             * @brief The sample rate of the clip, in Hz.
+             * @sharedapi
+             */
+            int SampleRate() const { return sampleRate; }
+
+            /**
+             * @brief The amount of channels of the clip.
+             * @sharedapi
+             */
+            int Channels() const { return channels; }
+
+            /**
+             * @brief The length of the clip in frames, one sample per channel each.
+             * @sharedapi
+             */
+            std::size_t Frames() const { return frames; }
+
+            /**
+             * @brief Whether the clip is decoded while playing instead of kept in memory.
+             * @sharedapi
+             */
+            bool Streaming() const { return streaming; }
+
+            /**
+             * @brief The decoded, interleaved samples.
+             * @return A view over the samples, empty for streaming clips.
+             * @sharedapi
+             */
+            Span<const float> Samples() const { return samples; }
+
+            /**
+             * @brief The memory used by the clip, excluding the buffers of its streams.
+             * @return The size in bytes.
+             * @sharedapi
+             */
+            std::size_t MemoryBytes() const { return samples.size() * sizeof(float); }
+
+            /**
+             * @brief The time it took to load the clip.
+             * @return The time in seconds.
+             * @sharedapi
+             */
+            double LoadTime() const { return loadTime; }
+
+        private:
+            friend class AudioClipCache;
+            AudioClip() = default;
+
+            std::string path;
+            int sampleRate {0};
+            int channels {0};
+            std::size_t frames {0};
+            bool streaming {false};
+            std::vector<float> samples;
+            double loadTime {0.0};
+
+#if __has_include("AudioClip_private.hpp")
+#include "AudioClip_private.hpp"
+#endif
+    };
+
+}
+
+#endif // AUDIOCLIP_H_
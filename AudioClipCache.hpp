@@ -0,0 +1,89 @@
+#ifndef AUDIOCLIPCACHE_H_
+#define AUDIOCLIPCACHE_H_
+
+#include "AudioClip.hpp"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if __has_include("AudioClipCache_includes.hpp")
+#include "AudioClipCache_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief Load statistics of one clip in the audio clip cache.
+     * @sharedapi
+     */
+    struct AudioClipStats {
+        std::string path;
+        bool streaming; // Whether the clip is decoded while playing
+        std::size_t memoryBytes; // Memory used by the decoded samples
+        double loadTime; // Time it took to load the clip, in seconds
+        long references; // Amount of holders of the clip, excluding the cache
+    };
+
+    /**
+     * @brief Cache which loads every audio clip path only once and shares the result.
+     * @details Clips whose decoded size is below the streaming threshold are decoded fully;
+     *          larger clips are streamed. Clips stay loaded while they are referenced.
+     * @sharedapi
+     */
+    class AudioClipCache {
+        private:
+            static AudioClipCache instance;
+            AudioClipCache();
+
+#if __has_include("AudioClipCache_private.hpp")
+#include "AudioClipCache_private.hpp"
+#endif
+
+        public:
+            static AudioClipCache& Instance();
+            AudioClipCache(const AudioClipCache&) = delete;
+            AudioClipCache& operator=(const AudioClipCache&) = delete;
+            AudioClipCache(const AudioClipCache&&) = delete;
+            AudioClipCache& operator=(AudioClipCache&&) = delete;
+
+            /**
+             * @brief Get a clip, loading it if it is not loaded yet.
+             * @param path The path of the audio file.
+             * @return A reference counted pointer to the clip.
+             * @exception A std::runtime_error is thrown when the file cannot be decoded.
+             * @sharedapi
+             */
+            std::shared_ptr<const AudioClip> Acquire(const std::string& path);
+
+            /**
+             * @brief Get the decoded size above which clips are streamed.
+             * @return The threshold in bytes
+             * @sharedapi
+             */
+            std::size_t StreamingThreshold() const;
+
+            /**
+             * @brief Set the decoded size above which clips are streamed. Only affects clips loaded afterwards.
+             * @param bytes The threshold in bytes
+             * @sharedapi
+             */
+            void StreamingThreshold(std::size_t bytes);
+
+            /**
+             * @brief Unload all clips which are no longer referenced.
+             * @sharedapi
+             */
+            void Trim();
+
+            /**
+             * @brief Get the load statistics of every loaded clip.
+             * @return A list with one entry per clip
+             * @sharedapi
+             */
+            std::vector<AudioClipStats> Report() const;
+    };
+
+}
+
+#endif // AUDIOCLIPCACHE_H_
@@ -0,0 +1,95 @@
+#ifndef AUDIOCONFIG_H_
+#define AUDIOCONFIG_H_
+
+#include <cstddef>
+#include <string>
+
+namespace spic {
+
+    /**
+     * @brief Enumeration for the different audio backends.
+     * @sharedapi
+     */
+    enum class AudioBackend {
+        device,
+        null,
+        wavFile
+    };
+
+    /**
+     * @brief A struct representing the audio configuration
+     * @sharedapi
+     */
+    struct AudioConfig {
+
+        /**
+         * @brief The backend receiving the mixed output. The device backend plays it on the
+         *        sound device, the null backend discards it and the wavFile backend writes
+         *        it to outputFile. The last two need no sound device
+         */
+        AudioBackend backend;
+
+        /**
+         * @brief A boolean flag if the null and wavFile backends should consume the output at
+         *        real-time pace. When false, they take buffers as fast as the mixer produces
+         *        them, which is useful to measure the cost of mixing. Unthrottled output is
+         *        not deterministic, since commands arrive at arbitrary buffer boundaries
+         */
+        bool throttled;
+
+        /**
+         * @brief A boolean flag if the mixer should run without an audio thread. The engine
+         *        then mixes the frames of every tick itself through AudioMixer::Render(), so
+         *        commands always land on the same buffer boundaries and the output of the
+         *        wavFile backend is the same on every run. Throttling does not apply
+         */
+        bool stepped {false};
+
+        /**
+         * @brief The path of the WAV file written by the wavFile backend
+         */
+        std::string outputFile;
+
+        /**
+         * @brief The sample rate of the mixed output, in Hz
+         */
+        int sampleRate {48000};
+
+        /**
+         * @brief The amount of output channels, 1 for mono or 2 for stereo
+         */
+        int channels {2};
+
+        /**
+         * @brief The amount of frames mixed at once by the audio thread. Smaller buffers
+         *        lower the latency, larger buffers survive longer stalls.
+         */
+        int bufferFrames {512};
+
+        /**
+         * @brief The decoded size in bytes above which clips are streamed instead of
+         *        decoded fully into memory
+         */
+        std::size_t streamingThreshold {std::size_t{4} * 1024 * 1024};
+
+        /**
+         * @brief The size of the ring buffer of each streaming clip, in frames
+         */
+        int streamBufferFrames {16384};
+
+        /**
+         * @brief The maximum amount of voices mixed at once. Voices beyond the limit become
+         *        virtual: their playback position advances but they are not mixed
+         */
+        int maxVoices {32};
+
+        /**
+         * @brief The default maximum amount of voices of one clip mixed at once
+         */
+        int maxVoicesPerClip {8};
+
+    };
+
+}
+
+#endif // AUDIOCONFIG_H_
@@ -0,0 +1,257 @@
+#ifndef AUDIOMIXER_H_
+#define AUDIOMIXER_H_
+
+#include "Span.hpp"
+#include "SpscQueue.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if __has_include("AudioMixer_includes.hpp")
+#include "AudioMixer_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief Enumeration for the commands the mixer accepts from the main thread.
+     * @sharedapi
+     */
+    enum class AudioCommandType {
+        play,
+        stop,
+        destroy,
+        volume,
+        pan,
+        priority,
+        maxVoices,
+        clipVoiceLimit
+    };
+
+    /**
+     * @brief A command for one voice of the mixer.
+     * @sharedapi
+     */
+    struct AudioCommand {
+        AudioCommandType type;
+        std::uint32_t voice; // The voice returned by AudioMixer::CreateVoice(), unused by the limits
+        std::uint32_t clip; // The clip returned by AudioMixer::ClipId(), only used by clipVoiceLimit
+        double value; // Volume (0 to 1), pan (-1 to 1), priority (0 to 255) or voice limit
+        bool looping; // Whether to loop, only used by play
+    };
+
+    /**
+     * @brief Software mixer running on a dedicated audio thread.
+     * @details The main thread never takes a lock on the audio path: every change to a voice
+     *          is sent as an AudioCommand through a lock-free single-producer queue, which the
+     *          audio thread drains before mixing each buffer. Mixing and sample conversion use
+     *          SIMD kernels. A frame hitch on the main thread only delays commands, never the output.
+     *
+     *          Because the queue has exactly one producer, CreateVoice(), DestroyVoice(),
+     *          Submit() and Flush(), and through them the AudioSource setters, must only be
+     *          called from the main thread, never from JobSystem jobs. Debug builds assert this.
+     *
+     *          The amount of mixed voices is bounded by the global and per clip voice limits.
+     *          When more voices play, the ones with the lowest priority and volume become
+     *          virtual: their position keeps advancing, but they are not mixed until a real
+     *          voice slot frees up. Inaudible voices are always virtual.
+     * @sharedapi
+     */
+    class AudioMixer {
+        private:
+            static AudioMixer instance;
+            AudioMixer();
+
+            SpscQueue<AudioCommand> commands;
+            std::vector<AudioCommand> overflow; // Commands which did not fit in the queue, main thread only
+            std::thread::id mainThread;
+            std::thread thread;
+            std::atomic<bool> running;
+
+#if __has_include("AudioMixer_private.hpp")
+#include "AudioMixer_private.hpp"
+#endif
+
+        public:
+            static AudioMixer& Instance();
+            AudioMixer(const AudioMixer&) = delete;
+            AudioMixer& operator=(const AudioMixer&) = delete;
+            AudioMixer(const AudioMixer&&) = delete;
+            AudioMixer& operator=(AudioMixer&&) = delete;
+
+            /**
+             * @brief Start the audio thread with the settings from the AudioConfig.
+             * @details The output goes to the backend selected in the AudioConfig. In stepped
+             *          mode no thread is started and nothing is mixed until Render() is called.
+             * @sharedapi
+             */
+            void Start();
+
+            /**
+             * @brief Mix frames on the calling thread, only available in stepped mode.
+             * @details Called by the engine from the main thread once per tick, after Flush(), with
+             *          the frames matching the duration of the tick. The fractional remainder is
+             *          carried to the next tick. The queued commands are drained first, so they
+             *          take effect at the start of the rendered block, the same on every run.
+             * @param frames The amount of frames to mix and hand to the backend.
+             * @exception A std::logic_error is thrown when the mixer is not in stepped mode.
+             * @sharedapi
+             */
+            void Render(std::size_t frames);
+
+            /**
+             * @brief Stop the audio thread, silencing all voices.
+             * @details The wavFile backend finishes its header so the file is complete.
+             * @sharedapi
+             */
+            void Stop();
+
+            /**
+             * @brief Create a voice for an audio clip, called from the main thread.
+             * @details The clip is acquired from the AudioClipCache; streaming clips get their own AudioStream.
+             * @param audioClip The path of the audio clip.
+             * @return The ID of the voice, used in commands.
+             * @exception A std::runtime_error is thrown when the clip cannot be loaded.
+             * @sharedapi
+             */
+            std::uint32_t CreateVoice(const std::string& audioClip);
+
+            /**
+             * @brief Stop and release a voice, called from the main thread.
+             * @details Sent as a destroy command, so the audio thread stops using the voice
+             *          before its clip is released. Like every command, it is never dropped.
+             * @param voice The ID of the voice.
+             * @sharedapi
+             */
+            void DestroyVoice(std::uint32_t voice);
+
+            /**
+             * @brief Send a command to the audio thread without blocking, called from the main thread.
+             * @details When the queue is full, the command is kept in an overflow list which is
+             *          sent before any later command and by Flush(). In the overflow list a
+             *          command replaces an earlier one of the same type for the same voice or clip, and
+             *          a stop or destroy removes a pending play, so the list stays small.
+             *          Commands are never dropped.
+             * @param command The command to send.
+             * @sharedapi
+             */
+            void Submit(const AudioCommand& command);
+
+            /**
+             * @brief Send the commands kept in the overflow list, called by the engine from the
+             *        main thread once per frame.
+             * @sharedapi
+             */
+            void Flush();
+
+            /**
+             * @brief The amount of voices currently mixed.
+             * @details Safe to call from any thread. The audio thread publishes the count after
+             *          each buffer, so it may lag one buffer behind the submitted commands.
+             * @sharedapi
+             */
+            std::size_t ActiveVoices() const;
+
+            /**
+             * @brief The amount of voices playing without being mixed.
+             * @details Safe to call from any thread, with the same lag as ActiveVoices().
+             * @sharedapi
+             */
+            std::size_t VirtualVoices() const;
+
+            /**
+             * @brief Whether a voice is playing without being mixed.
+             * @details Safe to call from any thread, with the same lag as ActiveVoices(). The
+             *          result for a destroyed voice is unspecified.
+             * @param voice The ID of the voice.
+             * @return true if the voice is virtual, false if it is mixed or not playing.
+             * @sharedapi
+             */
+            bool IsVirtual(std::uint32_t voice) const;
+
+            /**
+             * @brief Get the ID of an audio clip, used by clipVoiceLimit commands.
+             * @details Called from the main thread. The ID is assigned on first use and stays
+             *          the same while the mixer runs, whether or not the clip is loaded.
+             * @param audioClip The path of the audio clip.
+             * @return The ID of the clip.
+             * @sharedapi
+             */
+            std::uint32_t ClipId(const std::string& audioClip);
+
+            /**
+             * @brief Set the maximum amount of voices mixed at once, called from the main thread.
+             * @details Sent as a maxVoices command, so it takes effect from the next mixed buffer.
+             * @param limit The new limit, overriding AudioConfig::maxVoices.
+             * @sharedapi
+             */
+            void MaxVoices(int limit);
+
+            /**
+             * @brief Set the maximum amount of voices of one clip mixed at once, called from the
+             *        main thread.
+             * @details Sent as a clipVoiceLimit command with the ID from ClipId(), so the audio
+             *          thread never looks up clips by path. It takes effect from the next mixed buffer.
+             * @param audioClip The path of the audio clip.
+             * @param limit The new limit, overriding AudioConfig::maxVoicesPerClip for this clip.
+             * @sharedapi
+             */
+            void ClipVoiceLimit(const std::string& audioClip, int limit);
+
+            /**
+             * @brief The amount of frames mixed since the mixer was started.
+             * @sharedapi
+             */
+            std::uint64_t FramesMixed() const;
+
+            /**
+             * @brief The time the audio thread spent mixing since the mixer was started,
+             *        excluding the time waiting for the backend.
+             * @return The time in seconds
+             * @sharedapi
+             */
+            double MixTime() const;
+
+            /**
+             * @brief Add a mono signal to an interleaved stereo buffer.
+             * @param in The mono samples.
+             * @param out The stereo buffer, two samples per input sample.
+             * @param gainLeft The gain of the left channel, volume and pan combined.
+             * @param gainRight The gain of the right channel, volume and pan combined.
+             * @sharedapi
+             */
+            static void MixMono(Span<const float> in, Span<float> out, float gainLeft, float gainRight);
+
+            /**
+             * @brief Add an interleaved stereo signal to an interleaved stereo buffer.
+             * @param in The stereo samples.
+             * @param out The stereo buffer, same size as the input.
+             * @param gainLeft The gain of the left channel, volume and pan combined.
+             * @param gainRight The gain of the right channel, volume and pan combined.
+             * @sharedapi
+             */
+            static void MixStereo(Span<const float> in, Span<float> out, float gainLeft, float gainRight);
+
+            /**
+             * @brief Convert 16-bit samples to floats between -1 and 1.
+             * @param in The 16-bit samples.
+             * @param out The float samples, same size as the input.
+             * @sharedapi
+             */
+            static void ConvertToFloat(Span<const std::int16_t> in, Span<float> out);
+
+            /**
+             * @brief Convert float samples to 16-bit samples, clipping values outside -1 and 1.
+             * @param in The float samples.
+             * @param out The 16-bit samples, same size as the input.
+             * @sharedapi
+             */
+            static void ConvertToInt16(Span<const float> in, Span<std::int16_t> out);
+    };
+
+}
+
+#endif // AUDIOMIXER_H_
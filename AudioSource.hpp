@@ -2,6 +2,7 @@
 #define AUDIOSOURCE_H_
 
 #include "Component.hpp"
+#include <cstdint>
 #include <string>
 
 #if __has_include("AudioSource_includes.hpp")
@@ -12,6 +13,8 @@ namespace spic {
 
     /**
      * @brief Component which can play audio.
+     * @details Changes are sent to the AudioMixer as commands, so they never block on the audio thread.
+     *          Like the AudioMixer, it must only be used from the main thread.
      * @spicapi
      */
     class AudioSource : public Component {
@@ -53,6 +56,42 @@ namespace spic {
              */
             void Volume(double newVolume);
 
+            /**
+             * @brief Get the stereo position of the AudioSource
+             * @return The pan, from -1.0 for left to 1.0 for right
+             * @sharedapi
+             */
+            double Pan() const;
+
+            /**
+             * @brief Set the stereo position of the AudioSource
+             * @param newPan The new pan, from -1.0 for left to 1.0 for right
+             * @sharedapi
+             */
+            void Pan(double newPan);
+
+            /**
+             * @brief Get the priority of the AudioSource
+             * @return The priority, from 0 for the most important to 255 for the least important
+             * @sharedapi
+             */
+            int Priority() const;
+
+            /**
+             * @brief Set the priority of the AudioSource, deciding which voices stay mixed
+             *        when the voice limit is reached
+             * @param newPriority The new priority, from 0 to 255
+             * @sharedapi
+             */
+            void Priority(int newPriority);
+
+            /**
+             * @brief Get if the AudioSource is playing without being mixed
+             * @return true if its voice is virtual, false otherwise
+             * @sharedapi
+             */
+            bool Virtual() const;
+
 #if __has_include("AudioSource_public.hpp")
 #include "AudioSource_public.hpp"
 #endif
@@ -81,6 +120,24 @@ namespace spic {
              */
             double volume;
 
+            /**
+             * @brief Stereo position, between -1.0 and 1.0.
+             * @sharedapi
+             */
+            double pan {0.0};
+
+            /**
+             * @brief Voice priority, between 0 (most important) and 255.
+             * @sharedapi
+             */
+            int priority {128};
+
+            /**
+             * @brief The voice of the AudioMixer playing this source.
+             * @sharedapi
+             */
+            std::uint32_t voice;
+
 #if __has_include("AudioSource_private.hpp")
 #include "AudioSource_private.hpp"
 #endif
@@ -0,0 +1,80 @@
+#ifndef AUDIOSTREAM_H_
+#define AUDIOSTREAM_H_
+
+#include "AudioClip.hpp"
+#include "Span.hpp"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#if __has_include("AudioStream_includes.hpp")
+#include "AudioStream_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief Decodes a streaming clip in parts into a ring buffer while it plays.
+     * @details Refill() runs as a job on the JobSystem and Read() on the audio thread; the
+     *          two only share the atomic read and write positions.
+     * @sharedapi
+     */
+    class AudioStream {
+        public:
+            /**
+             * @brief Constructor.
+             * @param clip The streaming clip to decode.
+             * @param bufferFrames The size of the ring buffer in frames.
+             * @sharedapi
+             */
+            AudioStream(std::shared_ptr<const AudioClip> clip, std::size_t bufferFrames);
+
+            /**
+             * @brief Decode the next part of the clip into the free part of the ring buffer.
+             * @sharedapi
+             */
+            void Refill();
+
+            /**
+             * @brief Take decoded samples out of the ring buffer, without blocking.
+             * @details On an underrun the missing samples are filled with silence.
+             * @param out The buffer to write the interleaved samples to.
+             * @return The amount of frames read from the ring buffer.
+             * @sharedapi
+             */
+            std::size_t Read(Span<float> out);
+
+            /**
+             * @brief Restart decoding at a frame, discarding the buffered samples.
+             * @param frame The frame to continue from.
+             * @sharedapi
+             */
+            void Seek(std::size_t frame);
+
+            /**
+             * @brief Whether the whole clip has been decoded and read.
+             * @sharedapi
+             */
+            bool Finished() const;
+
+            /**
+             * @brief The clip being decoded.
+             * @sharedapi
+             */
+            const std::shared_ptr<const AudioClip>& Clip() const { return clip; }
+
+        private:
+            std::shared_ptr<const AudioClip> clip;
+            std::vector<float> ring;
+            std::atomic<std::size_t> readPosition;
+            std::atomic<std::size_t> writePosition;
+
+#if __has_include("AudioStream_private.hpp")
+#include "AudioStream_private.hpp"
+#endif
+    };
+
+}
+
+#endif // AUDIOSTREAM_H_
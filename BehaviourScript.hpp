@@ -41,6 +41,8 @@ namespace spic {
             /**
              * @brief Sent when another object enters a trigger collider
              *        attached to this object (2D physics only).
+             * @details Dispatched from Physics::DispatchEvents() after the physics step
+             *          has completed, never while the step is running.
              * @spicapi
              */
             virtual void OnTriggerEnter2D(const Collider& collider);
@@ -48,6 +50,8 @@ namespace spic {
             /**
              * @brief Sent when another object leaves a trigger collider
              *        attached to this object (2D physics only).
+             * @details Dispatched from Physics::DispatchEvents() after the physics step
+             *          has completed, never while the step is running.
              * @spicapi
              */
             virtual void OnTriggerExit2D(const Collider& collider);
@@ -55,6 +59,8 @@ namespace spic {
             /**
              * @brief Sent each frame where another object is within a trigger
              *        collider attached to this object (2D physics only).
+             * @details Dispatched from Physics::DispatchEvents() after the physics step
+             *          has completed, never while the step is running.
              * @spicapi
              */
             virtual void OnTriggerStay2D(const Collider& collider);
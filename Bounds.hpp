@@ -0,0 +1,63 @@
+#ifndef BOUNDS_H_
+#define BOUNDS_H_
+
+#include "Point.hpp"
+
+namespace spic
+{
+    /**
+     * @brief Struct representing an axis-aligned bounding box in world space.
+     * @sharedapi
+     */
+    struct Bounds
+    {
+        Point min; // Lower-left corner
+        Point max; // Upper-right corner
+
+        /**
+         * @brief The width of the bounds.
+         * @return The distance between the left and right edge.
+         * @sharedapi
+         */
+        double Width() const { return max.x - min.x; }
+
+        /**
+         * @brief The height of the bounds.
+         * @return The distance between the bottom and top edge.
+         * @sharedapi
+         */
+        double Height() const { return max.y - min.y; }
+
+        /**
+         * @brief The center of the bounds.
+         * @return The point in the middle of the bounds.
+         * @sharedapi
+         */
+        Point Center() const { return {(min.x + max.x) / 2.0, (min.y + max.y) / 2.0}; }
+
+        /**
+         * @brief Check whether a point lies within the bounds.
+         * @param point The point to test.
+         * @return true if the point is inside or on the edge, false otherwise.
+         * @sharedapi
+         */
+        bool Contains(const Point& point) const
+        {
+            return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y;
+        }
+
+        /**
+         * @brief Check whether two bounds overlap.
+         * @param other The bounds to test against.
+         * @return true if the bounds overlap or touch, false otherwise.
+         * @sharedapi
+         */
+        bool Intersects(const Bounds& other) const
+        {
+            return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y && max.y >= other.min.y;
+        }
+    };
+
+}
+
+#endif // BOUNDS_H_
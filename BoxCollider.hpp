@@ -37,7 +37,7 @@ namespace spic {
              * @param newWidth The desired width
              * @spicapi
              */
-            void Width(double newWidth) { width = newWidth; }
+            void Width(double newWidth) { width = newWidth; InvalidateBounds(); }
 
             /**
              * @brief The collider's height
@@ -51,7 +51,16 @@ namespace spic {
              * @param newHeight The desired height
              * @spicapi
              */
-            void Height(double newHeight) { height = newHeight; }
+            void Height(double newHeight) { height = newHeight; InvalidateBounds(); }
+
+        protected:
+            /**
+             * @brief Calculate the world bounds of the box, taking rotation and scale into account.
+             * @param transform The world transform of the owning GameObject.
+             * @return The axis-aligned bounds enclosing the box.
+             * @sharedapi
+             */
+            Bounds CalculateBounds(const spic::Transform& transform) const override;
 
         private:
             double width;
@@ -51,6 +51,8 @@ namespace spic {
 
             /**
              * @brief Set if the button is interactable
+             * @details Adds the button to or removes it from Scene::Interactables(), as long as
+             *          it is active in the world, see GameObject::Active().
              * @param isInteractable A new boolean value to define if the button should be interactable or not
              * @sharedapi
              */
@@ -3,6 +3,7 @@
 
 #include "GameObject.hpp"
 #include "Color.hpp"
+#include "Bounds.hpp"
 
 #if __has_include("Camera_includes.hpp")
 #include "Camera_includes.hpp"
@@ -73,8 +74,37 @@ namespace spic {
              */
             void AspectHeight(double newAspectHeight);
 
+            /**
+             * Get the area of the world visible through the camera, based on its
+             * transform and aspect size.
+             *
+             * @return the visible rectangle in world space.
+             * @sharedapi
+             */
+            Bounds VisibleBounds() const;
+
+            /**
+             * Get if renderables outside the visible area are skipped.
+             *
+             * @return true if culling is enabled, false otherwise.
+             * @sharedapi
+             */
+            bool Culling() const { return culling; }
+
+            /**
+             * Set if renderables outside the visible area are skipped.
+             *
+             * @sharedapi
+             */
+            void Culling(bool newCulling) { culling = newCulling; }
+
             /**
              * Tell the camera to start rendering the current scene.
+             * Renders through the backend selected in the RenderConfig. Sprites are taken
+             * in order from the DrawOrder() of the scene, so nothing is sorted per frame. When
+             * culling is enabled, the renderables index of the scene is first queried with
+             * VisibleBounds() to mark the visible GameObjects, and the walk over the draw
+             * order skips every sprite whose GameObject was not marked.
              *
              * @sharedapi
              */
@@ -84,6 +114,7 @@ namespace spic {
             Color backgroundColor;
             double aspectWidth;
             double aspectHeight;
+            bool culling {true};
     };
 
 }
@@ -36,7 +36,16 @@ namespace spic {
              * @param newRadius The desired radius
              * @spicapi
              */
-            void Radius(double newRadius) { radius = newRadius; }
+            void Radius(double newRadius) { radius = newRadius; InvalidateBounds(); }
+
+        protected:
+            /**
+             * @brief Calculate the world bounds of the circle, taking scale into account.
+             * @param transform The world transform of the owning GameObject.
+             * @return The axis-aligned bounds enclosing the circle.
+             * @sharedapi
+             */
+            Bounds CalculateBounds(const spic::Transform& transform) const override;
 
         private:
             double radius;
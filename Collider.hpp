@@ -2,6 +2,8 @@
 #define COLLIDER2D_H_
 
 #include "Component.hpp"
+#include "Bounds.hpp"
+#include "Transform.hpp"
 
 #if __has_include("Collider_includes.hpp")
 #include "Collider_includes.hpp"
@@ -35,7 +37,52 @@ namespace spic {
          */
         void IsTrigger(bool newIsTrigger);
 
+        /**
+         * @brief Get the axis-aligned bounds of the collider in world space.
+         * @details The bounds are cached and only recalculated by RefreshBounds(), which the
+         *          engine calls for every dirty collider in a serial pass before the physics
+         *          step. This call never writes, so it is safe to use from the jobs of a
+         *          parallel collision pass.
+         * @return A reference to the cached world bounds.
+         * @sharedapi
+         */
+        const Bounds& WorldBounds() const { return bounds; }
+
+        /**
+         * @brief Recalculate the cached world bounds if they have been invalidated.
+         * @details Must not run concurrently with WorldBounds() on the same collider.
+         * @sharedapi
+         */
+        void RefreshBounds();
+
+        /**
+         * @brief Mark the cached world bounds as stale.
+         * @details Called when the size of the collider changes, or by the owning
+         *          GameObject when its transform or parent chain changes.
+         * @sharedapi
+         */
+        void InvalidateBounds() { boundsDirty = true; }
+
+        /**
+         * @brief Get if the cached world bounds are stale.
+         * @return True if the bounds will be recalculated on the next call to RefreshBounds()
+         * @sharedapi
+         */
+        bool BoundsDirty() const { return boundsDirty; }
+
+    protected:
+        /**
+         * @brief Calculate the world bounds of this collider.
+         * @param transform The world transform of the owning GameObject.
+         * @return The axis-aligned bounds enclosing the collision area.
+         * @sharedapi
+         */
+        virtual Bounds CalculateBounds(const spic::Transform& transform) const = 0;
+
     private:
+        Bounds bounds {};
+        bool boundsDirty {true};
+
 #if __has_include("Collider_private.hpp")
 #include "Collider_private.hpp"
 #endif
@@ -1,8 +1,43 @@
 #ifndef COLOR_H_
 #define COLOR_H_
 
+#include <cstdint>
+
 namespace spic {
 
+    /**
+     * @brief A color packed into 8 bits per channel, as used by the renderers.
+     * @sharedapi
+     */
+    struct Color32 {
+        std::uint8_t r;
+        std::uint8_t g;
+        std::uint8_t b;
+        std::uint8_t a;
+
+        /**
+         * @brief The color as one 32-bit value, red in the lowest byte and alpha in the
+         *        highest, matching the pixel layout of the Framebuffer.
+         * @sharedapi
+         */
+        constexpr std::uint32_t Value() const
+        {
+            return static_cast<std::uint32_t>(r) | static_cast<std::uint32_t>(g) << 8u |
+                   static_cast<std::uint32_t>(b) << 16u | static_cast<std::uint32_t>(a) << 24u;
+        }
+    };
+
+    /**
+     * @brief A color stored as four IEEE 754 half-precision floats.
+     * @sharedapi
+     */
+    struct ColorHalf {
+        std::uint16_t r;
+        std::uint16_t g;
+        std::uint16_t b;
+        std::uint16_t a;
+    };
+
     /**
      * @brief Color represents a red-green-blue color with alpha.
      * @spicapi
@@ -16,7 +51,8 @@ namespace spic {
              * @param blue The blue component, 0 ≤ b ≤ 1.
              * @sharedapi
              */
-            Color(double red, double green, double blue);
+            constexpr Color(double red, double green, double blue)
+                    : r{red}, g{green}, b{blue}, a{1.0} {}
             
             /**
              * @brief Constructor, accepting an rgb value and an alpha (transparency).
@@ -26,91 +62,103 @@ namespace spic {
              * @param alpha The transparency component, 0 ≤ alpha ≤ 1.
              * @spicapi
              */
-            Color(double red, double green, double blue, double alpha);
+            constexpr Color(double red, double green, double blue, double alpha)
+                    : r{red}, g{green}, b{blue}, a{alpha} {}
+
+            /**
+             * @brief Convert a packed color.
+             * @param packed The packed color.
+             * @return The color with every channel between 0 and 1.
+             * @sharedapi
+             */
+            static constexpr Color FromColor32(const Color32& packed)
+            {
+                return {packed.r / 255.0, packed.g / 255.0, packed.b / 255.0, packed.a / 255.0};
+            }
 
             /**
              * @brief One of the standard colors (read-only): white.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& white() { return _white; }
+            static constexpr const Color& white() { return _white; }
 
             /**
              * @brief One of the standard colors (read-only): red.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& red() { return _red; }
+            static constexpr const Color& red() { return _red; }
 
             /**
              * @brief One of the standard colors (read-only): green.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& green() { return _green; }
+            static constexpr const Color& green() { return _green; }
 
             /**
              * @brief One of the standard colors (read-only): blue.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& blue() { return _blue; }
+            static constexpr const Color& blue() { return _blue; }
 
             /**
              * @brief One of the standard colors (read-only): cyan.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& cyan() { return _cyan; }
+            static constexpr const Color& cyan() { return _cyan; }
 
             /**
              * @brief One of the standard colors (read-only): magenta.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& magenta() { return _magenta; }
+            static constexpr const Color& magenta() { return _magenta; }
 
             /**
              * @brief One of the standard colors (read-only): yellow.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& yellow() { return _yellow; }
+            static constexpr const Color& yellow() { return _yellow; }
 
             /**
              * @brief One of the standard colors (read-only): black.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& black() { return _black; }
+            static constexpr const Color& black() { return _black; }
 
             /**
              * @brief One of the standard colors (read-only): purple.
              * @return A reference to a statically allocated Color instance.
              * @sharedapi
              */
-            static const Color& purple();
+            static constexpr const Color& purple() { return _purple; }
 
             /**
              * @brief One of the standard colors (read-only): lime.
              * @return A reference to a statically allocated Color instance.
              * @sharedapi
              */
-            static const Color& lime();
+            static constexpr const Color& lime() { return _lime; }
 
             /**
              * @brief One of the standard colors (read-only): orange.
              * @return A reference to a statically allocated Color instance.
              * @sharedapi
              */
-            static const Color& orange();
+            static constexpr const Color& orange() { return _orange; }
 
             /**
              * @brief One of the standard colors (read-only): transparent.
              * @return A reference to a statically allocated Color instance.
              * @sharedapi
              */
-            static const Color& transparent();
+            static constexpr const Color& transparent() { return _transparent; }
             // ... more standard colors here
 
             /**
@@ -137,28 +185,28 @@ namespace spic {
              * @return A reference to the statically red part of the color.
              * @sharedapi
              */
-            double R() const;
+            constexpr double R() const { return r; }
 
             /**
              * @brief The green part of the color
              * @return A reference to the statically green part of the color.
              * @sharedapi
              */
-            double G() const;
+            constexpr double G() const { return g; }
             
             /**
              * @brief The blue part of the color
              * @return A reference to the statically blue part of the color.
              * @sharedapi
              */
-            double B() const;
+            constexpr double B() const { return b; }
 
             /**
              * @brief The alpha part of the color
              * @return A reference to the statically alpha part of the color.
              * @sharedapi
              */
-            double A() const;
+            constexpr double A() const { return a; }
 
             /**
              * @brief Compare two instances of a color.
@@ -174,27 +222,56 @@ namespace spic {
              */
             bool operator!=(const Color& rhs) const;
 
+            /**
+             * @brief Pack the color into 8 bits per channel, clamping and rounding every channel.
+             * @return The packed color.
+             * @sharedapi
+             */
+            constexpr Color32 ToColor32() const
+            {
+                return {ToByte(r), ToByte(g), ToByte(b), ToByte(a)};
+            }
+
         private:
             double r;
             double g;
             double b;
             double a;
 
-            static Color _white;
-            static Color _red;
-            static Color _green;
-            static Color _blue;
-            static Color _cyan;
-            static Color _magenta;
-            static Color _yellow;
-            static Color _black;
-            static Color _purple;
-            static Color _lime;
-            static Color _orange;
-            static Color _transparent;
+            static constexpr std::uint8_t ToByte(double channel)
+            {
+                return static_cast<std::uint8_t>(channel <= 0.0 ? 0.0 : channel >= 1.0 ? 255.0 : channel * 255.0 + 0.5);
+            }
+
+            static const Color _white;
+            static const Color _red;
+            static const Color _green;
+            static const Color _blue;
+            static const Color _cyan;
+            static const Color _magenta;
+            static const Color _yellow;
+            static const Color _black;
+            static const Color _purple;
+            static const Color _lime;
+            static const Color _orange;
+            static const Color _transparent;
             // ... more standard color here
     };
 
+    constexpr Color Color::_white{1.0, 1.0, 1.0, 1.0};
+    constexpr Color Color::_red{1.0, 0.0, 0.0, 1.0};
+    constexpr Color Color::_green{0.0, 1.0, 0.0, 1.0};
+    constexpr Color Color::_blue{0.0, 0.0, 1.0, 1.0};
+    constexpr Color Color::_cyan{0.0, 1.0, 1.0, 1.0};
+    constexpr Color Color::_magenta{1.0, 0.0, 1.0, 1.0};
+    constexpr Color Color::_yellow{1.0, 1.0, 0.0, 1.0};
+    constexpr Color Color::_black{0.0, 0.0, 0.0, 1.0};
+    constexpr Color Color::_purple{0.5, 0.0, 0.5, 1.0};
+    constexpr Color Color::_lime{0.75, 1.0, 0.0, 1.0};
+    constexpr Color Color::_orange{1.0, 0.6, 0.0, 1.0};
+    constexpr Color Color::_transparent{0.0, 0.0, 0.0, 0.0};
+    // ... more standard colors here
+
 }
 
 #endif // COLOR_H_
@@ -3,8 +3,18 @@
 
 #include "Point.hpp"
 #include "Color.hpp"
+#include "Span.hpp"
+#include <cstddef>
 #include <string>
 
+/**
+ * @def SPIC_DISABLE_DEBUG_DRAW
+ * @brief Define SPIC_DISABLE_DEBUG_DRAW to compile the debug drawing functions out, turning
+ *        them into empty inline functions. It is independent of NDEBUG and must be defined
+ *        the same way when building the engine and the game; a mismatch leaves the game
+ *        without the functions it calls, or the engine with two definitions of them.
+ */
+
 namespace spic
 {
     /**
@@ -13,8 +23,23 @@ namespace spic
      */
     namespace Debug
     {
+        /**
+         * @brief A line queued in the debug line buffer.
+         * @sharedapi
+         */
+        struct Line
+        {
+            Point start;
+            Point end;
+            Color32 color;
+            double duration; // Remaining time in seconds, 0 for a single frame
+        };
+
+#ifndef SPIC_DISABLE_DEBUG_DRAW
         /**
          * @brief Draws a colored line between specified start and end points.
+         * @details The line is added to the line buffer, which is drawn in one batch at
+         *          the end of the frame.
          * @param start The starting point.
          * @param end The end point.
          * @param color The line color, defaults to white.
@@ -22,6 +47,37 @@ namespace spic
          */
         void DrawLine(const Point& start, const Point& end, const Color& color = Color::white());
 
+        /**
+         * @brief Draws a colored line between specified start and end points for a while.
+         * @param start The starting point.
+         * @param end The end point.
+         * @param color The line color.
+         * @param duration How long the line stays visible, in seconds.
+         * @sharedapi
+         */
+        void DrawLine(const Point& start, const Point& end, const Color& color, double duration);
+
+        /**
+         * @brief Draws all buffered lines in one batch and removes the expired ones.
+         * @details Called by the engine at the end of every frame, so lines are drawn on top
+         *          of everything else.
+         * @sharedapi
+         */
+        void FlushLines();
+
+        /**
+         * @brief The lines in the line buffer.
+         * @return A view over the lines, valid until the next DrawLine() or FlushLines().
+         * @sharedapi
+         */
+        Span<const Line> Lines();
+#else
+        inline void DrawLine(const Point&, const Point&, const Color& = Color::white()) {}
+        inline void DrawLine(const Point&, const Point&, const Color&, double) {}
+        inline void FlushLines() {}
+        inline Span<const Line> Lines() { return {}; }
+#endif
+
         /**
          * @brief Logs a message to the Console.
          * @param message The message to write.
@@ -0,0 +1,90 @@
+#ifndef DRAWLIST_H_
+#define DRAWLIST_H_
+
+#include "Sprite.hpp"
+#include "Span.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#if __has_include("DrawList_includes.hpp")
+#include "DrawList_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief A sprite in the draw list, together with the sort key it was inserted with.
+     * @sharedapi
+     */
+    struct DrawListEntry {
+        std::uint64_t key; // Sort key, see RenderQueue::SortKey()
+        const Sprite* sprite; // The sprite to draw
+    };
+
+    /**
+     * @brief Persistent list of sprites kept in draw order.
+     * @details Instead of sorting every visible sprite each frame, sprites are inserted at
+     *          their position once and only moved when their sort key changes. The cost of
+     *          keeping the order is proportional to the amount of sprites that changed.
+     * @sharedapi
+     */
+    class DrawList {
+        public:
+            /**
+             * @brief Insert a sprite at its position in the draw order.
+             * @param sprite The sprite to insert. Inserting a sprite twice has no effect.
+             * @sharedapi
+             */
+            void Insert(const Sprite& sprite);
+
+            /**
+             * @brief Remove a sprite from the draw order.
+             * @param sprite The sprite to remove. Removing an unknown sprite has no effect.
+             * @sharedapi
+             */
+            void Remove(const Sprite& sprite);
+
+            /**
+             * @brief Move a sprite to its new position after its sort key changed.
+             * @details Does nothing when the key did not change or the sprite is not in the list.
+             * @param sprite The sprite to reposition.
+             * @sharedapi
+             */
+            void Update(const Sprite& sprite);
+
+            /**
+             * @brief Check if a sprite is in the draw list.
+             * @param sprite The sprite to look for.
+             * @return true if the sprite is in the list, false otherwise.
+             * @sharedapi
+             */
+            bool Contains(const Sprite& sprite) const { return keys.count(&sprite) > 0; }
+
+            /**
+             * @brief The sprites in draw order.
+             * @return A view over the entries, valid until the list is modified
+             * @sharedapi
+             */
+            Span<const DrawListEntry> Entries() const { return entries; }
+
+            /**
+             * @brief The amount of sprites in the draw list.
+             * @return The amount of entries
+             * @sharedapi
+             */
+            std::size_t Size() const { return entries.size(); }
+
+        private:
+            std::vector<DrawListEntry> entries;
+            std::unordered_map<const Sprite*, std::uint64_t> keys;
+
+#if __has_include("DrawList_private.hpp")
+#include "DrawList_private.hpp"
+#endif
+    };
+
+}
+
+#endif // DRAWLIST_H_
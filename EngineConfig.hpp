@@ -1,6 +1,8 @@
 #ifndef ENGINECONFIG_H_
 #define ENGINECONFIG_H_
 
+#include "AudioConfig.hpp"
+#include "RenderConfig.hpp"
 #include "WindowConfig.hpp"
 
 namespace spic {
@@ -16,6 +18,22 @@ namespace spic {
          */
         WindowConfig window;
 
+        /**
+         * @brief The sub config for the renderer.
+         */
+        RenderConfig render;
+
+        /**
+         * @brief The sub config for the audio mixer.
+         */
+        AudioConfig audio;
+
+        /**
+         * @brief The amount of worker threads of the JobSystem, 0 to use one less than
+         *        the amount of hardware threads.
+         */
+        int workerThreads;
+
     };
 
 }
@@ -0,0 +1,89 @@
+#ifndef FRAMEBUFFER_H_
+#define FRAMEBUFFER_H_
+
+#include "Color.hpp"
+#include "Span.hpp"
+#include <cstdint>
+#include <vector>
+
+#if __has_include("Framebuffer_includes.hpp")
+#include "Framebuffer_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief An in-memory RGBA image the software backend renders into.
+     * @details Pixels are stored row by row starting at the top-left corner, one
+     *          32-bit value per pixel with red in the lowest byte and alpha in the highest.
+     * @sharedapi
+     */
+    class Framebuffer {
+        public:
+            /**
+             * @brief Constructor.
+             * @param width The width in pixels.
+             * @param height The height in pixels.
+             * @sharedapi
+             */
+            Framebuffer(int width, int height);
+
+            /**
+             * @brief Get the width of the framebuffer
+             * @return The width in pixels
+             * @sharedapi
+             */
+            int Width() const { return width; }
+
+            /**
+             * @brief Get the height of the framebuffer
+             * @return The height in pixels
+             * @sharedapi
+             */
+            int Height() const { return height; }
+
+            /**
+             * @brief Get the pixels of the framebuffer
+             * @return A view over all Width() * Height() pixels
+             * @sharedapi
+             */
+            Span<const std::uint32_t> Pixels() const { return pixels; }
+
+            /**
+             * @brief Get the color of a single pixel
+             * @param x The column, 0 ≤ x < Width().
+             * @param y The row, 0 ≤ y < Height().
+             * @return The color of the pixel
+             * @exception A std::out_of_range is thrown when the pixel lies outside the framebuffer.
+             * @sharedapi
+             */
+            Color Pixel(int x, int y) const;
+
+            /**
+             * @brief Fill the whole framebuffer with one color
+             * @param color The color to fill with
+             * @sharedapi
+             */
+            void Clear(const Color& color);
+
+            /**
+             * @brief Change the size of the framebuffer, discarding its contents
+             * @param newWidth The new width in pixels
+             * @param newHeight The new height in pixels
+             * @sharedapi
+             */
+            void Resize(int newWidth, int newHeight);
+
+        private:
+            int width;
+            int height;
+            std::vector<std::uint32_t> pixels;
+
+#if __has_include("Framebuffer_private.hpp")
+#include "Framebuffer_private.hpp"
+#endif
+    };
+
+}
+
+#endif // FRAMEBUFFER_H_
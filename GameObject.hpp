@@ -13,6 +13,8 @@
 
 namespace spic {
 
+    class Scene;
+
     /**
      * @brief Any object which should be represented on screen.
      * @spicapi
@@ -64,6 +66,8 @@ namespace spic {
              * @brief Removes a GameObject from the administration.
              * @details TODO What happens if this GameObject is a parent to others? What happens
              *          to the Components it possesses?
+             *          When called while Physics::DispatchEvents() runs, e.g. from
+             *          OnTriggerEnter2D(), the GameObject is removed after dispatch has completed.
              * @param obj The GameObject to be destroyed. Must be a valid pointer to existing Game Object.
              * @exception A std::runtime_exception is thrown when the pointer is not valid.
              * @spicapi
@@ -72,7 +76,9 @@ namespace spic {
 
             /**
              * @brief Removes a Component.
-             * @details Will search for the Component among the GameObjects.
+             * @details Will search for the Component among the GameObjects. When called while
+             *          Physics::DispatchEvents() runs, the Component is removed after dispatch
+             *          has completed.
              * @param obj The Component to be removed.
              * @spicapi
              */
@@ -117,7 +123,9 @@ namespace spic {
              *        subclass of Component. The GameObject assumes ownership of
              *        the Component.
              * @details This function places a pointer to the component in
-             *          a suitable container.
+             *          a suitable container. Sprites are inserted in the draw order
+             *          of the scene this GameObject belongs to, if any. Adding an Animator
+             *          also adds its sprite when that sprite is not on a GameObject yet.
              * @param component Reference to the component.
              * @spicapi
              */
@@ -126,6 +134,8 @@ namespace spic {
 
             /**
              * @brief Removes a component from a game object.
+             * @details Sprites are removed from the draw order of the scene this GameObject
+             *          belongs to, if any.
              * @param component Reference to the component.
              * @sharedapi
              */
@@ -191,6 +201,9 @@ namespace spic {
 
             /**
              * @brief Activates/Deactivates the GameObject, depending on the given true or false value.
+             * @details Adds the interactable Buttons of this GameObject and its children that become
+             *          active in the world to Scene::Interactables(), and removes the ones that
+             *          become inactive.
              * @param active Desired value.
              * @spicapi
              */
@@ -213,14 +226,25 @@ namespace spic {
             bool IsActiveInWorld() const;
 
             /**
-             * @brief Returns the transform of this GameObject
-             * @return A reference to the transform
+             * @brief Set the transform of this GameObject
+             * @details Invalidates the cached world-space data of this GameObject and its children.
+             * @param transform The new transform
+             * @sharedapi
+             */
+            void Transform(const spic::Transform& transform);
+
+            /**
+             * @brief Mark the cached world-space data of this GameObject and its children
+             *        as stale, such as the world bounds of their colliders, their
+             *        entries in Scene::Renderables() and the layout of UIObjects.
              * @sharedapi
              */
-            spic::Transform& Transform();
+            void InvalidateTransform();
 
             /**
              * @brief Returns a const reference to the transform of this GameObject
+             * @details Reading the transform never invalidates cached world-space data.
+             *          Change it through the setter, so the change cannot go unnoticed.
              * @return A const reference to the transform
              * @sharedapi
              */
@@ -235,6 +259,7 @@ namespace spic {
 
             /**
              * The parent of this GameObject.
+             * Invalidates the cached world-space data of this GameObject and its children.
              * @param parent A weak pointer to the new parent
              * @sharedapi
              */
@@ -247,8 +272,17 @@ namespace spic {
              */
             const std::vector<std::shared_ptr<GameObject>>& Children() const;
 
+            /**
+             * The scene this GameObject belongs to, either directly through Scene::Add()
+             * or through its parent.
+             * @return Pointer to the scene, or nullptr if it is in no scene. No ownership.
+             * @sharedapi
+             */
+            spic::Scene* Scene() const;
+
             /**
              * Add a child to the children of this GameObject.
+             * The child and its children join the scene of this GameObject.
              * @param child the child to add.
              * @sharedapi
              */
@@ -256,6 +290,7 @@ namespace spic {
 
             /**
              * Remove a child from the children of this GameObject.
+             * The child and its children leave the scene of this GameObject.
              * @param child the child to remove.
              * @sharedapi
              */
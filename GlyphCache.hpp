@@ -0,0 +1,100 @@
+#ifndef GLYPHCACHE_H_
+#define GLYPHCACHE_H_
+
+#include "TextureAtlas.hpp"
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#if __has_include("GlyphCache_includes.hpp")
+#include "GlyphCache_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief A rasterized character of a font at one size.
+     * @sharedapi
+     */
+    struct Glyph {
+        char32_t codepoint; // The unicode codepoint
+        AtlasRegion region; // Where the glyph is stored in the glyph pages
+        double advance; // Horizontal distance to the next glyph, in pixels
+        double bearingX; // Offset from the pen position to the left edge, in pixels
+        double bearingY; // Offset from the baseline to the top edge, in pixels
+    };
+
+    /**
+     * @brief The glyphs and glyph pages rasterized since the last GlyphCache::Clear().
+     * @details Defined by the engine. Holding a pointer keeps the glyphs and pages alive.
+     * @sharedapi
+     */
+    class GlyphStorage;
+
+    /**
+     * @brief Cache of rasterized glyphs, keyed by font, size and codepoint.
+     * @details Glyphs are rasterized once into shared glyph pages, so changing the
+     *          content of a Text only rasterizes characters which were never drawn before.
+     * @sharedapi
+     */
+    class GlyphCache {
+        private:
+            static GlyphCache instance;
+            GlyphCache();
+
+#if __has_include("GlyphCache_private.hpp")
+#include "GlyphCache_private.hpp"
+#endif
+
+        public:
+            static GlyphCache& Instance();
+            GlyphCache(const GlyphCache&) = delete;
+            GlyphCache& operator=(const GlyphCache&) = delete;
+            GlyphCache(const GlyphCache&&) = delete;
+            GlyphCache& operator=(GlyphCache&&) = delete;
+
+            /**
+             * @brief Get a glyph, rasterizing it if it is not cached yet.
+             * @param font The path of the font.
+             * @param size The size of the font.
+             * @param codepoint The character to get.
+             * @return A reference to the glyph, valid until Clear() is called or, beyond that,
+             *         while the Storage() it was returned from is held.
+             * @exception A std::runtime_error is thrown when the font cannot be loaded.
+             * @sharedapi
+             */
+            const Glyph& Get(const std::string& font, int size, char32_t codepoint);
+
+            /**
+             * @brief The storage of the current glyphs and pages.
+             * @details Clear() starts a new storage; the old one is freed once it is no longer held.
+             * @return A shared pointer to the storage.
+             * @sharedapi
+             */
+            std::shared_ptr<const GlyphStorage> Storage() const;
+
+            /**
+             * @brief The amount of glyphs in the cache.
+             * @sharedapi
+             */
+            std::size_t Size() const;
+
+            /**
+             * @brief The amount of pages the glyphs are stored in.
+             * @sharedapi
+             */
+            std::size_t PageCount() const;
+
+            /**
+             * @brief Remove all glyphs and pages.
+             * @details Layouts keep the storage of their glyphs alive, so this is safe while
+             *          layouts are held. Also clears the TextLayoutCache, so new layouts use
+             *          the new glyphs.
+             * @sharedapi
+             */
+            void Clear();
+    };
+
+}
+
+#endif // GLYPHCACHE_H_
@@ -12,6 +12,8 @@
 
 namespace spic {
 
+    class Button;
+
     /**
      * @brief Some convenient input functions.
      * @spicapi
@@ -364,6 +366,24 @@ namespace spic {
          */
         void UnregisterMouseListener(IMouseListener& listener);
 
+        /**
+         * Find the button which would receive a click at a position.
+         * Looks up the interactable buttons index of the active scene, so the cost does not
+         * depend on the amount of buttons. Inactive and non-interactable buttons are skipped;
+         * of overlapping buttons the one on the highest layer wins.
+         * @param position The position in pixel coordinates.
+         * @return Pointer to the button, or nullptr if there is none. No ownership.
+         * @sharedapi
+         */
+        Button* ButtonAt(const Point& position);
+
+        /**
+         * The button under the mouse, updated once per frame from MousePosition().
+         * @return Pointer to the button, or nullptr if there is none. No ownership.
+         * @sharedapi
+         */
+        Button* HoveredButton();
+
 #if __has_include("Input_public.hpp")
 #include "Input_public.hpp"
 #endif
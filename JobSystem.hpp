@@ -0,0 +1,77 @@
+#ifndef JOBSYSTEM_H_
+#define JOBSYSTEM_H_
+
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#if __has_include("JobSystem_includes.hpp")
+#include "JobSystem_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief A pool of worker threads to spread work of the engine over multiple cores.
+     * @details The amount of workers is set with EngineConfig::workerThreads.
+     * @sharedapi
+     */
+    class JobSystem {
+        private:
+            static JobSystem instance;
+            JobSystem();
+
+            std::vector<std::thread> workers;
+
+#if __has_include("JobSystem_private.hpp")
+#include "JobSystem_private.hpp"
+#endif
+
+        public:
+            static JobSystem& Instance();
+            JobSystem(const JobSystem&) = delete;
+            JobSystem& operator=(const JobSystem&) = delete;
+            JobSystem(const JobSystem&&) = delete;
+            JobSystem& operator=(JobSystem&&) = delete;
+
+            /**
+             * @brief The amount of worker threads.
+             * @sharedapi
+             */
+            std::size_t WorkerCount() const { return workers.size(); }
+
+            /**
+             * @brief The index of the calling thread, to select per-thread data.
+             * @return 0 for the main thread, 1 to WorkerCount() for the workers.
+             * @sharedapi
+             */
+            static std::size_t ThreadIndex();
+
+            /**
+             * @brief Run a job on one of the workers.
+             * @param job The job to run.
+             * @sharedapi
+             */
+            void Schedule(std::function<void()> job);
+
+            /**
+             * @brief Split a range into batches and run them on the workers and the calling thread.
+             * @details Returns when all batches are done.
+             * @param count The size of the range.
+             * @param batchSize The maximum amount of elements per batch.
+             * @param job The job to run for each batch, receiving its begin and end index.
+             * @sharedapi
+             */
+            void ParallelFor(std::size_t count, std::size_t batchSize, const std::function<void(std::size_t, std::size_t)>& job);
+
+            /**
+             * @brief Wait until all scheduled jobs are done.
+             * @sharedapi
+             */
+            void Wait();
+    };
+
+}
+
+#endif // JOBSYSTEM_H_
@@ -0,0 +1,194 @@
+#ifndef PARTICLEEMITTER_H_
+#define PARTICLEEMITTER_H_
+
+#include "Color.hpp"
+#include "Component.hpp"
+#include "Point.hpp"
+#include "Span.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#if __has_include("ParticleEmitter_includes.hpp")
+#include "ParticleEmitter_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief A struct describing how a ParticleEmitter spawns and changes its particles.
+     * @sharedapi
+     */
+    struct ParticleSettings {
+        std::size_t maxParticles; // Particles are not emitted while this many are alive
+        double emissionRate; // Particles emitted per second while playing
+        double minLifetime; // Shortest lifetime of a particle, in seconds
+        double maxLifetime; // Longest lifetime of a particle, in seconds
+        double minSpeed; // Lowest start speed, in world units per second
+        double maxSpeed; // Highest start speed, in world units per second
+        double direction; // Main emission direction, in radians
+        double spread; // Maximum deviation from the direction, in radians
+        Point gravity; // Acceleration applied every second
+        Color32 startColor; // Color at the start of the lifetime
+        Color32 endColor; // Color at the end of the lifetime
+        double startSize; // Size at the start of the lifetime, in world units
+        double endSize; // Size at the end of the lifetime, in world units
+    };
+
+    /**
+     * @brief Read-only views over the particle buffers of an emitter.
+     * @details Every span has one element per living particle. Positions are in world space:
+     *          particles are spawned at the world position of the emitter and keep moving
+     *          independently of it, so the renderer does not apply the emitter transform.
+     * @sharedapi
+     */
+    struct ParticleView {
+        Span<const float> positionX;
+        Span<const float> positionY;
+        Span<const float> velocityX;
+        Span<const float> velocityY;
+        Span<const float> life; // Elapsed fraction of the lifetime, 0 ≤ life < 1
+        Span<const float> size;
+        Span<const Color32> color;
+    };
+
+    /**
+     * @brief A component which emits and simulates many small sprites without creating GameObjects.
+     * @details Particles are stored as separate arrays per property and updated with SIMD
+     *          kernels, split over the JobSystem when parallel updating is enabled. All
+     *          particles of an emitter are rendered as one batch with the same texture.
+     * @sharedapi
+     */
+    class ParticleEmitter : public Component {
+        public:
+            /**
+             * @brief Constructor.
+             * @param texture The path of the texture of every particle.
+             * @param settings How particles are spawned and changed.
+             * @param sortingLayer The layer the particles will be sorted on.
+             * @param orderInLayer The layer the particles will be ordered on.
+             * @sharedapi
+             */
+            ParticleEmitter(const std::string& texture, const ParticleSettings& settings, int sortingLayer = 0, int orderInLayer = 0);
+
+            /**
+             * @brief Start emitting particles at the emission rate.
+             * @sharedapi
+             */
+            void Play();
+
+            /**
+             * @brief Stop emitting particles. Living particles finish their lifetime.
+             * @sharedapi
+             */
+            void Stop();
+
+            /**
+             * @brief Whether the emitter is emitting particles.
+             * @sharedapi
+             */
+            bool Playing() const;
+
+            /**
+             * @brief Emit particles at once, e.g. for an explosion.
+             * @param count The amount of particles, limited by the maximum in the settings.
+             * @sharedapi
+             */
+            void Emit(std::size_t count);
+
+            /**
+             * @brief Remove all living particles.
+             * @sharedapi
+             */
+            void Clear();
+
+            /**
+             * @brief Emit, move, age and remove particles.
+             * @details Called by the engine once per frame. Dead particles are removed by
+             *          swapping in the last particle, so the buffers stay contiguous.
+             * @param deltaTime The scaled time since the last update, in seconds.
+             * @sharedapi
+             */
+            void Update(double deltaTime);
+
+            /**
+             * @brief The amount of living particles.
+             * @sharedapi
+             */
+            std::size_t Count() const { return life.size(); }
+
+            /**
+             * @brief Views over the buffers of the living particles.
+             * @sharedapi
+             */
+            ParticleView Particles() const;
+
+            /**
+             * @brief The path of the texture of every particle.
+             * @sharedapi
+             */
+            const std::string& Texture() const { return texture; }
+
+            /**
+             * @brief The layer the particles will be sorted on.
+             * @sharedapi
+             */
+            int SortingLayer() const { return sortingLayer; }
+
+            /**
+             * @brief The layer the particles will be ordered on.
+             * @sharedapi
+             */
+            int OrderInLayer() const { return orderInLayer; }
+
+            /**
+             * @brief How particles are spawned and changed.
+             * @sharedapi
+             */
+            const ParticleSettings& Settings() const { return settings; }
+
+            /**
+             * @brief How particles are spawned and changed. Living particles keep their start values.
+             * @param newSettings desired value
+             * @sharedapi
+             */
+            void Settings(const ParticleSettings& newSettings);
+
+            /**
+             * @brief Whether the update is split over the JobSystem.
+             * @sharedapi
+             */
+            bool Parallel() const { return parallel; }
+
+            /**
+             * @brief Whether the update is split over the JobSystem. Only worth it for large emitters.
+             * @param newParallel desired value
+             * @sharedapi
+             */
+            void Parallel(bool newParallel) { parallel = newParallel; }
+
+        private:
+            std::string texture;
+            ParticleSettings settings;
+            int sortingLayer;
+            int orderInLayer;
+            bool playing;
+            bool parallel {false};
+            double emissionDebt {0.0};
+            std::vector<float> positionX;
+            std::vector<float> positionY;
+            std::vector<float> velocityX;
+            std::vector<float> velocityY;
+            std::vector<float> life;
+            std::vector<float> lifeRate;
+            std::vector<float> size;
+            std::vector<Color32> color;
+
+#if __has_include("ParticleEmitter_private.hpp")
+#include "ParticleEmitter_private.hpp"
+#endif
+    };
+
+}
+
+#endif // PARTICLEEMITTER_H_
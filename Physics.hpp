@@ -0,0 +1,87 @@
+#ifndef PHYSICS_H_
+#define PHYSICS_H_
+
+#include "Collider.hpp"
+#include "Point.hpp"
+#include "Span.hpp"
+
+#if __has_include("Physics_includes.hpp")
+#include "Physics_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief Access to the results of the physics step.
+     * @sharedapi
+     */
+    namespace Physics {
+
+        /**
+         * @brief Enumeration for the phases of a contact between two colliders.
+         * @sharedapi
+         */
+        enum class CollisionEventType {
+            enter,
+            stay,
+            exit
+        };
+
+        /**
+         * @brief A contact or trigger event recorded during the physics step.
+         * @details Every contact is recorded once for each of the two colliders involved,
+         *          so all events of one collider are stored next to each other. Events
+         *          involving a collider destroyed during DispatchEvents() are removed when
+         *          dispatch completes, so the collider pointers of the remaining events stay valid.
+         * @sharedapi
+         */
+        struct CollisionEvent {
+            CollisionEventType type;
+            Collider* collider; // The collider the event is reported for
+            Collider* other; // The collider it touches
+            bool trigger; // Whether one of the colliders is a trigger
+            Point point; // Contact point in world space, unused for triggers
+            Point normal; // Contact normal pointing away from other, unused for triggers
+        };
+
+        /**
+         * @brief All events recorded during the last physics step.
+         * @details The events are buffered while the step runs and sorted by collider
+         *          afterwards. The span stays valid until the next physics step, except that
+         *          DispatchEvents() compacts it, so take the span again after dispatch.
+         * @return A view over the event stream.
+         * @sharedapi
+         */
+        Span<const CollisionEvent> Events();
+
+        /**
+         * @brief The events recorded for one collider during the last physics step.
+         * @details Valid for as long as the span returned by Events().
+         * @param collider The collider to get the events for.
+         * @return A view over the events where collider is the reporting collider,
+         *         empty if it touched nothing.
+         * @sharedapi
+         */
+        Span<const CollisionEvent> GetContacts(const Collider& collider);
+
+        /**
+         * @brief Dispatch the buffered trigger events to the BehaviourScripts of the
+         *        GameObjects involved.
+         * @details Called by the engine after the physics step has completed, so no
+         *          script code runs while the step is in progress. GameObjects and Components
+         *          destroyed by a script during dispatch are only removed once dispatch has
+         *          completed, so no event points to a freed collider. Remaining events of a
+         *          collider whose GameObject or Component was destroyed are skipped, and all
+         *          events involving it are removed from Events() before the colliders are freed.
+         * @sharedapi
+         */
+        void DispatchEvents();
+
+#if __has_include("Physics_public.hpp")
+#include "Physics_public.hpp"
+#endif
+    }
+
+}
+
+#endif // PHYSICS_H_
@@ -0,0 +1,66 @@
+#ifndef RENDERCONFIG_H_
+#define RENDERCONFIG_H_
+
+#include <cstddef>
+
+namespace spic {
+
+    /**
+     * @brief Enumeration for the different render backends.
+     * @sharedapi
+     */
+    enum class RenderBackend {
+        window,
+        software
+    };
+
+    /**
+     * @brief A struct representing the render configuration
+     * @sharedapi
+     */
+    struct RenderConfig {
+
+        /**
+         * @brief The backend used to render the scene. The window backend draws to the
+         *        application window, the software backend rasterizes on the CPU into an
+         *        in-memory framebuffer without opening a window.
+         */
+        RenderBackend backend;
+
+        /**
+         * @brief The amount of memory in bytes decoded textures may use before the
+         *        TextureCache evicts unused ones.
+         */
+        std::size_t textureBudget {std::size_t{256} * 1024 * 1024};
+
+        /**
+         * @brief The maximum amount of prescaled levels generated for every texture when it is
+         *        decoded, 0 to only keep the full resolution image. Sprites drawn at a reduced
+         *        scale sample the matching level.
+         */
+        int maxMipLevels;
+
+        /**
+         * @brief The cell size in world units of the spatial index used for culling.
+         *        About the size of a screen works well for most levels.
+         */
+        double cullingCellSize {1024.0};
+
+        /**
+         * @brief The cell size in screen pixels of the spatial index used for hit-testing
+         *        buttons. A few times the size of a typical button works well.
+         */
+        double uiCellSize {64.0};
+
+        /**
+         * @brief A boolean flag if only the changed regions of the screen should be redrawn.
+         *        Meant for mostly static scenes like menus; moving the camera still
+         *        redraws the whole frame.
+         */
+        bool dirtyRectangles;
+
+    };
+
+}
+
+#endif // RENDERCONFIG_H_
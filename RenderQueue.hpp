@@ -0,0 +1,265 @@
+#ifndef RENDERQUEUE_H_
+#define RENDERQUEUE_H_
+
+#include "Sprite.hpp"
+#include "Span.hpp"
+#include "Transform.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if __has_include("RenderQueue_includes.hpp")
+#include "RenderQueue_includes.hpp"
+#endif
+
+namespace spic {
+
+    class Tilemap;
+    class ParticleEmitter;
+
+    /**
+     * @brief Enumeration for the kinds of draws in the render queue.
+     * @sharedapi
+     */
+    enum class RenderCommandKind {
+        sprite,
+        tilemapChunk,
+        particles
+    };
+
+    /**
+     * @brief A single draw recorded in the render queue.
+     * @details Sprites, tilemap chunks and particle emitters share the queue, so they are
+     *          sorted against each other by layer and counted the same way.
+     * @sharedapi
+     */
+    struct RenderCommand {
+        std::uint64_t key; // Sort key, see RenderQueue::SortKey()
+        RenderCommandKind kind; // What source points to
+        const Component* source; // The Sprite, Tilemap or ParticleEmitter to draw
+        std::size_t chunk; // Index of the chunk for tilemapChunk, unused otherwise
+        std::uint32_t texture; // ID of the texture drawn from, see Renderer::ResolveTexture()
+        Transform transform; // World transform of the source, identity for particles
+    };
+
+    /**
+     * @brief A run of consecutive render commands which share a kind, texture and blend mode,
+     *        submitted as one draw.
+     * @sharedapi
+     */
+    struct RenderBatch {
+        std::size_t first; // Index of the first command in the batch
+        std::size_t count; // Amount of commands in the batch
+        RenderCommandKind kind; // Kind shared by the commands
+        std::uint32_t texture; // ID of the texture the commands are drawn from, the atlas page for atlas sprites
+        BlendMode blendMode; // Blend mode shared by the commands
+    };
+
+    /**
+     * @brief A list of render commands for one fixed range of work, such as a sorting
+     *        layer or a screen region, recorded by one job.
+     * @sharedapi
+     */
+    class RenderCommandBuffer {
+        public:
+            /**
+             * @brief Add a sprite to the buffer.
+             * @details The key uses the ID of the texture the sprite is drawn from, as given by
+             *          Renderer::ResolveTexture(), so sprites on the same atlas page share a batch.
+             * @param sprite The sprite to draw. Must outlive the current frame.
+             * @param transform The world transform to draw the sprite at.
+             * @sharedapi
+             */
+            void Push(const Sprite& sprite, const Transform& transform);
+
+            /**
+             * @brief Add a chunk of a tilemap to the buffer.
+             * @details Chunks sort at the lowest order in layer, below the sprites of their layer.
+             * @param tilemap The tilemap to draw. Must outlive the current frame.
+             * @param chunk The index of the chunk, row-major.
+             * @param transform The world transform of the tilemap.
+             * @sharedapi
+             */
+            void Push(const Tilemap& tilemap, std::size_t chunk, const Transform& transform);
+
+            /**
+             * @brief Add all particles of an emitter to the buffer, drawn as one command.
+             * @details Particle positions are already in world space, see ParticleView, so the
+             *          command gets an identity transform.
+             * @param emitter The emitter to draw. Must outlive the current frame.
+             * @sharedapi
+             */
+            void Push(const ParticleEmitter& emitter);
+
+            /**
+             * @brief Sort the commands by key with a radix sort.
+             * @details The radix passes are skipped when the commands were pushed in key
+             *          order, which is the case when the buffer is filled from a DrawList.
+             * @sharedapi
+             */
+            void Sort();
+
+            /**
+             * @brief Remove all commands, keeping the allocated memory for the next frame.
+             * @sharedapi
+             */
+            void Clear();
+
+            /**
+             * @brief The commands in the buffer.
+             * @return A view over the commands
+             * @sharedapi
+             */
+            Span<const RenderCommand> Commands() const { return commands; }
+
+        private:
+            std::vector<RenderCommand> commands;
+            std::vector<RenderCommand> sortBuffer;
+    };
+
+    /**
+     * @brief Per-frame queue of draws, sorted by a packed key and merged into batches.
+     * @details Commands can be pushed directly, or recorded in parallel into one
+     *          RenderCommandBuffer per range of work and merged afterwards.
+     * @sharedapi
+     */
+    class RenderQueue {
+        public:
+            /**
+             * @brief Pack the draw order and render state of a sprite into one sort key.
+             * @details From the most to the least significant bits the key holds the sorting
+             *          layer (16 bits), the order in layer (16 bits), the blend mode (2 bits)
+             *          and the texture ID (30 bits). Layer and order are offset so negative
+             *          values sort before positive ones. Values outside the range of 16 bits
+             *          are clamped to it, so they sort with the nearest value in range instead
+             *          of wrapping around. Sprites with the same layer and order have no
+             *          defined draw order, which lets them be grouped by texture.
+             * @param sortingLayer The sorting layer of the sprite, -32768 ≤ sortingLayer ≤ 32767.
+             * @param orderInLayer The order in layer of the sprite, -32768 ≤ orderInLayer ≤ 32767.
+             * @param texture The ID of the texture the sprite is drawn from.
+             * @param blendMode The blend mode of the sprite.
+             * @return The sort key.
+             * @sharedapi
+             */
+            static std::uint64_t SortKey(int sortingLayer, int orderInLayer, std::uint32_t texture, BlendMode blendMode);
+
+            /**
+             * @brief Add a sprite to the queue.
+             * @details The key uses the ID of the texture the sprite is drawn from, as given by
+             *          Renderer::ResolveTexture(), so sprites on the same atlas page share a batch.
+             * @param sprite The sprite to draw. Must outlive the current frame.
+             * @param transform The world transform to draw the sprite at.
+             * @sharedapi
+             */
+            void Push(const Sprite& sprite, const Transform& transform);
+
+            /**
+             * @brief Add a chunk of a tilemap to the queue.
+             * @details Chunks sort at the lowest order in layer, below the sprites of their layer.
+             * @param tilemap The tilemap to draw. Must outlive the current frame.
+             * @param chunk The index of the chunk, row-major.
+             * @param transform The world transform of the tilemap.
+             * @sharedapi
+             */
+            void Push(const Tilemap& tilemap, std::size_t chunk, const Transform& transform);
+
+            /**
+             * @brief Add all particles of an emitter to the queue, drawn as one command.
+             * @details Particle positions are already in world space, see ParticleView, so the
+             *          command gets an identity transform.
+             * @param emitter The emitter to draw. Must outlive the current frame.
+             * @sharedapi
+             */
+            void Push(const ParticleEmitter& emitter);
+
+            /**
+             * @brief Sort the commands by key with a radix sort and build the batches.
+             * @details The radix passes are skipped when the commands were pushed in key
+             *          order, which is the case when the queue is filled from a DrawList.
+             * @sharedapi
+             */
+            void Sort();
+
+            /**
+             * @brief Set the amount of command buffers, one per range of work (sorting layer or
+             *        screen region), independent of the amount of threads.
+             * @param count The amount of buffers.
+             * @sharedapi
+             */
+            void Buffers(std::size_t count);
+
+            /**
+             * @brief The amount of command buffers.
+             * @sharedapi
+             */
+            std::size_t BufferCount() const { return buffers.size(); }
+
+            /**
+             * @brief Get a command buffer to record into.
+             * @details Index buffers by range, never by JobSystem::ThreadIndex(): the range a
+             *          thread gets differs from frame to frame. Each buffer is recorded into by
+             *          the single job handling its range, in a fixed order.
+             * @param index The index of the buffer, 0 ≤ index < BufferCount().
+             * @return A reference to the buffer.
+             * @sharedapi
+             */
+            RenderCommandBuffer& Buffer(std::size_t index) { return buffers.at(index); }
+
+            /**
+             * @brief Sort every command buffer and merge them into the queue in key order,
+             *        then build the batches.
+             * @details Each buffer is sorted stably and commands with equal keys keep the order
+             *          of their buffer index. Since buffers correspond to ranges of work, the
+             *          result does not depend on which thread recorded what. The buffers are cleared.
+             * @sharedapi
+             */
+            void Merge();
+
+            /**
+             * @brief Remove all commands and batches, keeping the allocated memory for the next frame.
+             * @sharedapi
+             */
+            void Clear();
+
+            /**
+             * @brief The commands in the queue, in draw order after Sort() has been called.
+             * @return A view over the commands
+             * @sharedapi
+             */
+            Span<const RenderCommand> Commands() const { return commands; }
+
+            /**
+             * @brief The batches built by the last call to Sort().
+             * @return A view over the batches
+             * @sharedapi
+             */
+            Span<const RenderBatch> Batches() const { return batches; }
+
+            /**
+             * @brief The amount of sprites, tilemap chunks and particle emitters drawn.
+             * @return The amount of commands in the queue
+             * @sharedapi
+             */
+            std::size_t DrawCount() const { return commands.size(); }
+
+            /**
+             * @brief The amount of draws submitted to the backend.
+             * @return The amount of batches in the queue
+             * @sharedapi
+             */
+            std::size_t BatchCount() const { return batches.size(); }
+
+        private:
+            std::vector<RenderCommand> commands;
+            std::vector<RenderCommand> sortBuffer;
+            std::vector<RenderBatch> batches;
+            std::vector<RenderCommandBuffer> buffers;
+
+#if __has_include("RenderQueue_private.hpp")
+#include "RenderQueue_private.hpp"
+#endif
+    };
+
+}
+
+#endif // RENDERQUEUE_H_
@@ -0,0 +1,68 @@
+#ifndef RENDERSTATS_H_
+#define RENDERSTATS_H_
+
+#include <cstddef>
+
+namespace spic {
+
+    /**
+     * @brief A struct representing the statistics of one rendered frame.
+     * @sharedapi
+     */
+    struct RenderStats {
+
+        /**
+         * @brief The amount of sprites considered for rendering.
+         */
+        std::size_t spritesSubmitted;
+
+        /**
+         * @brief The amount of submitted sprites skipped because they were outside the camera.
+         */
+        std::size_t spritesCulled;
+
+        /**
+         * @brief The amount of tilemap chunks drawn.
+         */
+        std::size_t tilemapChunks;
+
+        /**
+         * @brief The amount of particles drawn, over all emitters.
+         */
+        std::size_t particles;
+
+        /**
+         * @brief The amount of batches built by the render queue.
+         */
+        std::size_t batches;
+
+        /**
+         * @brief The amount of draw calls issued to the backend, including text, lines and particles.
+         */
+        std::size_t drawCalls;
+
+        /**
+         * @brief The amount of times the bound texture changed between draw calls.
+         */
+        std::size_t textureSwitches;
+
+        /**
+         * @brief The amount of text glyphs drawn.
+         */
+        std::size_t glyphsDrawn;
+
+        /**
+         * @brief The estimated average amount of times each screen pixel was written.
+         */
+        double overdraw;
+
+        /**
+         * @brief The time spent rendering the frame, in seconds.
+         */
+        double renderTime;
+
+    };
+
+}
+
+#endif // RENDERSTATS_H_
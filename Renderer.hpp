@@ -0,0 +1,145 @@
+#ifndef RENDERER_H_
+#define RENDERER_H_
+
+#include "Bounds.hpp"
+#include "Framebuffer.hpp"
+#include "RenderConfig.hpp"
+#include "RenderQueue.hpp"
+#include "RenderStats.hpp"
+#include "Span.hpp"
+#include "TextureAtlas.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#if __has_include("Renderer_includes.hpp")
+#include "Renderer_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief Access to the render backend selected in the EngineConfig.
+     * @sharedapi
+     */
+    namespace Renderer {
+
+        /**
+         * @brief The backend the engine was initialized with.
+         * @return The render backend
+         * @sharedapi
+         */
+        RenderBackend Backend();
+
+        /**
+         * @brief The framebuffer the software backend renders into.
+         * @details The framebuffer has the size of the configured window and contains the
+         *          last frame rendered by Camera::Render(), including sprites, text and lines
+         *          drawn with Debug::DrawLine(). Alpha blending and sprite blits are done
+         *          with SIMD kernels, so the cost is representative without a GPU.
+         * @return A reference to the framebuffer
+         * @exception A std::logic_error is thrown when the software backend is not selected.
+         * @sharedapi
+         */
+        const Framebuffer& SoftwareFramebuffer();
+
+        /**
+         * @brief The render queue of the last rendered frame.
+         * @details Can be used to compare the amount of sprites drawn to the amount of batches.
+         * @return A reference to the sorted and batched render queue
+         * @sharedapi
+         */
+        const RenderQueue& Queue();
+
+        /**
+         * @brief Register an atlas, so sprites using one of its images are drawn from the atlas.
+         * @details Sprites keep their original texture path. Images that are in more than one
+         *          registered atlas are drawn from the atlas registered last. Pages of an atlas
+         *          packed in memory are added to the TextureCache with TextureAtlas::RegisterPages().
+         * @param atlas The packed atlas to register.
+         * @sharedapi
+         */
+        void RegisterAtlas(std::shared_ptr<const TextureAtlas> atlas);
+
+        /**
+         * @brief Unregister an atlas, so its images are drawn from their original files again.
+         * @param atlas The atlas to unregister.
+         * @sharedapi
+         */
+        void UnregisterAtlas(const std::shared_ptr<const TextureAtlas>& atlas);
+
+        /**
+         * @brief Get the texture a sprite texture is drawn from.
+         * @details The lookup is by ID, so resolving the texture of every sprite each frame
+         *          does not hash any paths.
+         * @param texture The texture ID of a sprite, see Sprite::TextureId().
+         * @return The ID of the atlas page the texture was packed in when it is in a
+         *         registered atlas, otherwise texture itself.
+         * @sharedapi
+         */
+        std::uint32_t ResolveTexture(std::uint32_t texture);
+
+        /**
+         * @brief Mark an area of the world to be redrawn in the next frame.
+         * @details Only used when dirty rectangles are enabled in the RenderConfig. The engine
+         *          marks the old and new bounds of renderables when their transform is
+         *          invalidated, when a Sprite or Text property or color changes and when
+         *          they are added or removed. Overlapping areas are merged.
+         * @param area The area in world space.
+         * @sharedapi
+         */
+        void MarkDirty(const Bounds& area);
+
+        /**
+         * @brief Mark the whole screen to be redrawn in the next frame.
+         * @sharedapi
+         */
+        void MarkAllDirty();
+
+        /**
+         * @brief The regions redrawn in the last frame.
+         * @details Contains a single region covering the screen when dirty rectangles are
+         *          disabled or the whole screen was marked.
+         * @return A view over the regions in screen pixels.
+         * @sharedapi
+         */
+        Span<const Bounds> DirtyRegions();
+
+        /**
+         * @brief The statistics of the last rendered frame.
+         * @return A reference to the statistics, overwritten when the next frame is rendered.
+         * @sharedapi
+         */
+        const RenderStats& Stats();
+
+        /**
+         * @brief Show the statistics of the last frame in the top-left corner of the screen.
+         * @details The overlay is drawn with a Text on top of everything else and is not
+         *          included in the statistics it shows.
+         * @param font The font to draw the overlay with.
+         * @param size The size of the font.
+         * @sharedapi
+         */
+        void ShowStatsOverlay(const std::string& font, int size = 14);
+
+        /**
+         * @brief Hide the statistics overlay.
+         * @sharedapi
+         */
+        void HideStatsOverlay();
+
+        /**
+         * @brief Get if the statistics overlay is shown.
+         * @return true if shown, false otherwise
+         * @sharedapi
+         */
+        bool StatsOverlayVisible();
+
+#if __has_include("Renderer_public.hpp")
+#include "Renderer_public.hpp"
+#endif
+    }
+
+}
+
+#endif // RENDERER_H_
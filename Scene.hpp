@@ -1,6 +1,8 @@
 #ifndef SCENE_H_
 #define SCENE_H_
 
+#include "DrawList.hpp"
+#include "SpatialGrid.hpp"
 #include <vector>
 #include <memory>
 
@@ -11,6 +13,7 @@
 namespace spic {
 
     class GameObject;
+    class Button;
 
     /**
      * @brief Class representing a scene which can be rendered by the Camera.
@@ -32,16 +35,84 @@ namespace spic {
 
             /**
              * @brief This function is called by a Camera to render the scene on the engine.
+             * @details The visible renderables are split by sorting layer or screen region
+             *          and recorded on the JobSystem, one command buffer per range, which are
+             *          merged in sort order before submission.
              * @spicapi
              */
             void RenderScene();
 
             /**
              * @brief This property contains all the Game Object that are contained in this scene.
+             * @details Prefer Add() and Remove() to change the contents, which keep the indices of
+             *          the scene in sync. After changing the vector directly, call Resync().
              * @spicapi
              */
             std::vector<std::shared_ptr<GameObject>>& Contents();
 
+            /**
+             * @brief This property contains all the Game Object that are contained in this scene.
+             * @sharedapi
+             */
+            const std::vector<std::shared_ptr<GameObject>>& Contents() const;
+
+            /**
+             * @brief Rebuild DrawOrder(), Renderables() and Interactables() from Contents().
+             * @details Needed after changing Contents() directly. Also called by the engine when
+             *          the scene is pushed.
+             * @sharedapi
+             */
+            void Resync();
+
+            /**
+             * @brief Add a GameObject to this scene.
+             * @details Inserts the sprites of the GameObject and its children in DrawOrder(),
+             *          their bounds in Renderables() and their interactable Buttons in
+             *          Interactables(). A GameObject belongs to at most one scene; adding it
+             *          to a scene removes it from the scene it was in. Adding a GameObject
+             *          twice has no effect.
+             * @param gameObject The GameObject to add.
+             * @sharedapi
+             */
+            void Add(const std::shared_ptr<GameObject>& gameObject);
+
+            /**
+             * @brief Remove a GameObject from this scene.
+             * @details Removes the GameObject and its children from the indices of this scene.
+             *          Removing a GameObject that is not in this scene has no effect.
+             * @param gameObject The GameObject to remove.
+             * @sharedapi
+             */
+            void Remove(const std::shared_ptr<GameObject>& gameObject);
+
+            /**
+             * @brief The sprites of this scene in draw order.
+             * @details Kept up to date when GameObjects join or leave the scene, when sprites
+             *          are added to or removed from its GameObjects and when their sort key
+             *          changes, so rendering the scene does not need to sort.
+             * @sharedapi
+             */
+            DrawList& DrawOrder();
+
+            /**
+             * @brief Spatial index of the world bounds of all GameObjects with a Sprite or Text.
+             * @details An entry is updated when the transform of its GameObject is invalidated,
+             *          so only moving renderables touch the index. Camera::Render() only uses it
+             *          to mark visible GameObjects; the drawing order comes from DrawOrder().
+             * @sharedapi
+             */
+            SpatialGrid<GameObject>& Renderables();
+
+            /**
+             * @brief Spatial index of the layout rectangles of all interactable, active Buttons.
+             * @details An entry is updated when the layout of its Button is recomputed, and
+             *          added or removed when its interactable state changes or when it becomes
+             *          active or inactive in the world, including through a parent. The cells
+             *          are RenderConfig::uiCellSize pixels wide, independent of the culling grid.
+             * @sharedapi
+             */
+            SpatialGrid<Button>& Interactables();
+
     private:
 #if __has_include("Scene_private.hpp")
 #include "Scene_private.hpp"
@@ -0,0 +1,77 @@
+#ifndef SPAN_H_
+#define SPAN_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief A non-owning view over a contiguous sequence of elements.
+     * @details The view is only valid as long as the underlying storage is not modified.
+     * @sharedapi
+     */
+    template<class T>
+    class Span {
+        public:
+            /**
+             * @brief Constructor for an empty span.
+             * @sharedapi
+             */
+            Span() : data(nullptr), count(0) {}
+
+            /**
+             * @brief Constructor.
+             * @param data Pointer to the first element.
+             * @param count The amount of elements.
+             * @sharedapi
+             */
+            Span(T* data, std::size_t count) : data(data), count(count) {}
+
+            /**
+             * @brief Constructor, viewing the contents of a vector.
+             * @param vector The vector to view.
+             * @sharedapi
+             */
+            Span(std::vector<std::remove_const_t<T>>& vector) : data(vector.data()), count(vector.size()) {}
+
+            /**
+             * @brief Constructor, viewing the contents of a const vector.
+             * @details Only available for spans over const elements.
+             * @param vector The vector to view.
+             * @sharedapi
+             */
+            template<class U = T, typename std::enable_if<std::is_const<U>::value, int>::type = 0>
+            Span(const std::vector<std::remove_const_t<T>>& vector) : data(vector.data()), count(vector.size()) {}
+
+            T* begin() const { return data; }
+            T* end() const { return data + count; }
+            T& operator[](std::size_t index) const { return data[index]; }
+
+            /**
+             * @brief Get a pointer to the first element.
+             * @sharedapi
+             */
+            T* Data() const { return data; }
+
+            /**
+             * @brief Get the amount of elements.
+             * @sharedapi
+             */
+            std::size_t Size() const { return count; }
+
+            /**
+             * @brief Get if the span has no elements.
+             * @sharedapi
+             */
+            bool Empty() const { return count == 0; }
+
+        private:
+            T* data;
+            std::size_t count;
+    };
+
+}
+
+#endif // SPAN_H_
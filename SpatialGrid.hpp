@@ -0,0 +1,98 @@
+#ifndef SPATIALGRID_H_
+#define SPATIALGRID_H_
+
+#include "Bounds.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief A uniform grid of cells, used to find the items overlapping an area
+     *        without testing every item.
+     * @details Items are stored in every cell their bounds overlap. Updating an item
+     *          only touches the grid when the set of cells it overlaps changes.
+     * @sharedapi
+     */
+    template<class T>
+    class SpatialGrid {
+        public:
+            /**
+             * @brief Constructor.
+             * @param cellSize The width and height of a cell in world units.
+             * @sharedapi
+             */
+            explicit SpatialGrid(double cellSize);
+
+            /**
+             * @brief Add an item to the grid.
+             * @param item The item to add. Adding an item twice updates its bounds.
+             * @param bounds The world bounds of the item.
+             * @sharedapi
+             */
+            void Insert(T* item, const Bounds& bounds);
+
+            /**
+             * @brief Change the bounds of an item in the grid.
+             * @param item The item to update. Unknown items are inserted.
+             * @param bounds The new world bounds of the item.
+             * @sharedapi
+             */
+            void Update(T* item, const Bounds& bounds);
+
+            /**
+             * @brief Remove an item from the grid.
+             * @param item The item to remove. Removing an unknown item has no effect.
+             * @sharedapi
+             */
+            void Remove(T* item);
+
+            /**
+             * @brief Find the items whose bounds overlap an area.
+             * @param area The area to search.
+             * @param result The vector to append the items to. Each item is appended once.
+             * @sharedapi
+             */
+            void Query(const Bounds& area, std::vector<T*>& result) const;
+
+            /**
+             * @brief Find the items whose bounds contain a point.
+             * @param point The point to search.
+             * @param result The vector to append the items to.
+             * @sharedapi
+             */
+            void Query(const Point& point, std::vector<T*>& result) const;
+
+            /**
+             * @brief Remove all items from the grid.
+             * @sharedapi
+             */
+            void Clear();
+
+            /**
+             * @brief The amount of items in the grid.
+             * @sharedapi
+             */
+            std::size_t Size() const { return items.size(); }
+
+            /**
+             * @brief The width and height of a cell in world units.
+             * @sharedapi
+             */
+            double CellSize() const { return cellSize; }
+
+        private:
+            double cellSize;
+            std::unordered_map<std::int64_t, std::vector<T*>> cells;
+            std::unordered_map<T*, Bounds> items;
+    };
+
+}
+
+#if __has_include("SpatialGrid_templates.hpp")
+#include "SpatialGrid_templates.hpp"
+#endif
+
+#endif // SPATIALGRID_H_
@@ -3,12 +3,27 @@
 
 #include "Component.hpp"
 #include "Color.hpp"
+#include "Texture.hpp"
+#include <cstdint>
+#include <memory>
 #include <string>
 
 namespace spic {
 
+    /**
+     * @brief Enumeration for the ways a sprite is blended with what is behind it.
+     * @sharedapi
+     */
+    enum class BlendMode {
+        opaque,
+        alpha,
+        additive
+    };
+
     /**
      * @brief A component representing a sprite (small image)
+     * @details A sprite holds a reference to its texture, requested from the TextureCache
+     *          when the texture path is set, so a texture is never evicted while a sprite uses it.
      * @spicapi
      */
     class Sprite : public Component {
@@ -38,6 +53,8 @@ namespace spic {
 
             /**
              * @brief The texture of the sprite
+             * @details Requests the new texture from the TextureCache and releases the old
+             *          one. Moves the sprite to its new position in the draw order of its scene.
              * @param sprite the path to the sprite
              * @sharedapi
              */
@@ -50,8 +67,25 @@ namespace spic {
              */
             const std::string& Texture() const;
 
+            /**
+             * @brief The texture drawn by the sprite, held while the sprite uses it
+             * @return A reference counted pointer to the texture, which may still be pending
+             * @sharedapi
+             */
+            const std::shared_ptr<const spic::Texture>& TextureHandle() const { return texture; }
+
+            /**
+             * @brief The ID of the texture, interned by the TextureCache
+             * @details Only used as sort and batch key; drawing uses TextureHandle().
+             * @return The texture ID
+             * @sharedapi
+             */
+            std::uint32_t TextureId() const;
+
             /**
              * @brief The color of the sprite
+             * @details The color is stored packed, 8 bits per channel, so renderers read it
+             *          without converting on every draw. Every channel is rounded to a multiple of 1/255.
              * @param color the color
              * @sharedapi
              */
@@ -59,10 +93,19 @@ namespace spic {
 
             /**
              * @brief The color of the sprite
+             * @details Unpacked from 8 bits per channel, so it can differ from the color that
+             *          was set by up to 1/510 per channel, e.g. 0.5 reads back as 128/255.
              * @return the color
              * @sharedapi
              */
-            const spic::Color& Color() const;
+            spic::Color Color() const { return spic::Color::FromColor32(color); }
+
+            /**
+             * @brief The color of the sprite, packed as it is stored
+             * @return the packed color
+             * @sharedapi
+             */
+            Color32 PackedColor() const { return color; }
 
             /**
              * @brief Whether the sprite should be flipped on the X-axis
@@ -94,6 +137,7 @@ namespace spic {
 
             /**
              * @brief The layer the sprite will be sorted on
+             * @details Moves the sprite to its new position in the draw order of its scene.
              * @param sortingLayer desired value
              * @sharedapi
              */
@@ -108,6 +152,7 @@ namespace spic {
 
             /**
              * @brief The layer the sprite will be ordered on
+             * @details Moves the sprite to its new position in the draw order of its scene.
              * @param orderInLayer desired value
              * @sharedapi
              */
@@ -120,13 +165,31 @@ namespace spic {
              */
             int OrderInLayer() const;
 
+            /**
+             * @brief The way the sprite is blended with what is behind it
+             * @details Moves the sprite to its new position in the draw order of its scene.
+             * @param blendMode desired value
+             * @sharedapi
+             */
+            void BlendMode(spic::BlendMode blendMode);
+
+            /**
+             * @brief The way the sprite is blended with what is behind it
+             * @return current value, defaults to alpha blending
+             * @sharedapi
+             */
+            spic::BlendMode BlendMode() const;
+
         private:
             std::string sprite;
-            spic::Color color;
+            std::uint32_t textureId;
+            std::shared_ptr<const spic::Texture> texture;
+            Color32 color;
             bool flipX;
             bool flipY;
             int sortingLayer;
             int orderInLayer;
+            spic::BlendMode blendMode {spic::BlendMode::alpha};
     };
 
 }
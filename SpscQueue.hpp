@@ -0,0 +1,60 @@
+#ifndef SPSCQUEUE_H_
+#define SPSCQUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief A bounded, lock-free queue for one producer thread and one consumer thread.
+     * @details Pushing and popping never block or allocate. The head and tail are kept on
+     *          separate cache lines, so the two threads do not slow each other down.
+     * @sharedapi
+     */
+    template<class T>
+    class SpscQueue {
+        public:
+            /**
+             * @brief Constructor.
+             * @param capacity The maximum amount of elements in the queue.
+             * @sharedapi
+             */
+            explicit SpscQueue(std::size_t capacity);
+
+            /**
+             * @brief Add an element, only to be called from the producer thread.
+             * @param value The element to add.
+             * @return true if added, false if the queue is full.
+             * @sharedapi
+             */
+            bool TryPush(const T& value);
+
+            /**
+             * @brief Remove the oldest element, only to be called from the consumer thread.
+             * @param value The element to move the removed element into.
+             * @return true if an element was removed, false if the queue is empty.
+             * @sharedapi
+             */
+            bool TryPop(T& value);
+
+            /**
+             * @brief The maximum amount of elements in the queue.
+             * @sharedapi
+             */
+            std::size_t Capacity() const { return buffer.size() - 1; }
+
+        private:
+            std::vector<T> buffer;
+            alignas(64) std::atomic<std::size_t> head;
+            alignas(64) std::atomic<std::size_t> tail;
+    };
+
+}
+
+#if __has_include("SpscQueue_templates.hpp")
+#include "SpscQueue_templates.hpp"
+#endif
+
+#endif // SPSCQUEUE_H_
@@ -59,6 +59,7 @@ namespace spic {
 
             /**
              * @brief Set the text content of the Text object
+             * @details Invalidates the layout of the Text object.
              * @param text new content
              * @sharedapi
              */
@@ -73,6 +74,7 @@ namespace spic {
 
             /**
              * @brief Set the font of the Text object
+             * @details Invalidates the layout of the Text object.
              * @param font the new font
              * @sharedapi
              */
@@ -87,6 +89,7 @@ namespace spic {
 
             /**
              * @brief Set the size of the Text object
+             * @details Invalidates the layout of the Text object.
              * @param size the new size
              * @sharedapi
              */
@@ -101,6 +104,7 @@ namespace spic {
 
             /**
              * @brief Set the alignment of the content of the Text object
+             * @details Invalidates the layout of the Text object.
              * @param alignment the new alignment
              * @sharedapi
              */
@@ -108,13 +112,25 @@ namespace spic {
 
             /**
              * @brief Get the color of the Text object
-             * @return A reference to the color of the Text object
+             * @details Unpacked from 8 bits per channel, so it can differ from the color that
+             *          was set by up to 1/510 per channel.
+             * @return The color of the Text object
              * @sharedapi
              */
-            const Color& TextColor() const;
+            Color TextColor() const { return Color::FromColor32(color); }
+
+            /**
+             * @brief Get the color of the Text object, packed as it is stored
+             * @return The packed color of the Text object
+             * @sharedapi
+             */
+            Color32 PackedTextColor() const { return color; }
 
             /**
              * @brief Set the color of the Text object
+             * @details The color is stored packed, 8 bits per channel, rounding every channel
+             *          to a multiple of 1/255. Does not invalidate
+             *          the cached layout of the text.
              * @param color the new color
              * @sharedapi
              */
@@ -125,7 +141,7 @@ namespace spic {
             std::string font;
             int size;
             Alignment alignment;
-            Color color;
+            Color32 color;
     };
 
 }
@@ -0,0 +1,87 @@
+#ifndef TEXTLAYOUTCACHE_H_
+#define TEXTLAYOUTCACHE_H_
+
+#include "GlyphCache.hpp"
+#include "Point.hpp"
+#include "Text.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#if __has_include("TextLayoutCache_includes.hpp")
+#include "TextLayoutCache_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief A glyph placed relative to the top-left corner of a Text.
+     * @sharedapi
+     */
+    struct PositionedGlyph {
+        const Glyph* glyph; // Kept alive by TextLayout::storage
+        Point position;
+    };
+
+    /**
+     * @brief The shaped and aligned glyphs of a piece of text.
+     * @sharedapi
+     */
+    struct TextLayout {
+        std::vector<PositionedGlyph> glyphs;
+        std::shared_ptr<const GlyphStorage> storage; // The glyphs and pages the layout points into
+        double width; // Width of the widest line, in pixels
+        double height; // Height of all lines together, in pixels
+    };
+
+    /**
+     * @brief Cache of text layouts, keyed by content, font, size, alignment and width.
+     * @details The color is not part of the key, so recoloring a Text reuses its layout.
+     * @sharedapi
+     */
+    class TextLayoutCache {
+        private:
+            static TextLayoutCache instance;
+            TextLayoutCache();
+
+#if __has_include("TextLayoutCache_private.hpp")
+#include "TextLayoutCache_private.hpp"
+#endif
+
+        public:
+            static TextLayoutCache& Instance();
+            TextLayoutCache(const TextLayoutCache&) = delete;
+            TextLayoutCache& operator=(const TextLayoutCache&) = delete;
+            TextLayoutCache(const TextLayoutCache&&) = delete;
+            TextLayoutCache& operator=(TextLayoutCache&&) = delete;
+
+            /**
+             * @brief Get the layout of a Text, laying it out if it is not cached yet.
+             * @param text The text to get the layout for.
+             * @return A shared pointer to the layout.
+             * @sharedapi
+             */
+            std::shared_ptr<const TextLayout> Layout(const Text& text);
+
+            /**
+             * @brief The amount of layouts in the cache.
+             * @sharedapi
+             */
+            std::size_t Size() const;
+
+            /**
+             * @brief Remove layouts which are no longer referenced.
+             * @sharedapi
+             */
+            void Trim();
+
+            /**
+             * @brief Remove all layouts.
+             * @sharedapi
+             */
+            void Clear();
+    };
+
+}
+
+#endif // TEXTLAYOUTCACHE_H_
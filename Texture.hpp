@@ -0,0 +1,136 @@
+#ifndef TEXTURE_H_
+#define TEXTURE_H_
+
+#include "Span.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if __has_include("Texture_includes.hpp")
+#include "Texture_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief Enumeration for the loading states of a texture.
+     * @sharedapi
+     */
+    enum class TextureState {
+        pending,
+        ready,
+        failed
+    };
+
+    /**
+     * @brief One level of the mip chain of a texture.
+     * @sharedapi
+     */
+    struct TextureLevel {
+        int width;
+        int height;
+        Span<const std::uint32_t> pixels;
+    };
+
+    /**
+     * @brief A decoded image, shared by every sprite using the same texture path.
+     * @details Pixels use the same layout as the Framebuffer. Textures are created and
+     *          owned by the TextureCache.
+     * @sharedapi
+     */
+    class Texture {
+        public:
+            /**
+             * @brief Constructor.
+             * @param path The path the image was decoded from.
+             * @param width The width in pixels.
+             * @param height The height in pixels.
+             * @param pixels The decoded pixels, width * height values.
+             * @sharedapi
+             */
+            Texture(const std::string& path, int width, int height, std::vector<std::uint32_t> pixels);
+
+            /**
+             * @brief The path the image was decoded from.
+             * @sharedapi
+             */
+            const std::string& Path() const { return path; }
+
+            /**
+             * @brief The width in pixels.
+             * @sharedapi
+             */
+            int Width() const { return width; }
+
+            /**
+             * @brief The height in pixels.
+             * @sharedapi
+             */
+            int Height() const { return height; }
+
+            /**
+             * @brief The decoded pixels.
+             * @return A view over all Width() * Height() pixels
+             * @sharedapi
+             */
+            Span<const std::uint32_t> Pixels() const { return pixels; }
+
+            /**
+             * @brief The amount of memory used by the decoded pixels, including the mip levels.
+             * @return The size in bytes
+             * @sharedapi
+             */
+            std::size_t Bytes() const;
+
+            /**
+             * @brief The amount of levels in the mip chain, including the full resolution image.
+             * @details Each level has half the width and height of the previous one. The amount
+             *          of levels generated on load is limited by RenderConfig::maxMipLevels.
+             * @sharedapi
+             */
+            std::size_t LevelCount() const { return 1 + mipLevels.size(); }
+
+            /**
+             * @brief Get one level of the mip chain.
+             * @param level The level, 0 for the full resolution image.
+             * @return The size and pixels of the level.
+             * @exception A std::out_of_range is thrown when the level does not exist.
+             * @sharedapi
+             */
+            TextureLevel Level(std::size_t level) const;
+
+            /**
+             * @brief Choose the level to sample when the texture is drawn at a scale.
+             * @param scale The effective scale on screen, the world scale of the Transform.
+             * @return The smallest level which is at least as large as the drawn size.
+             * @sharedapi
+             */
+            std::size_t SelectLevel(double scale) const;
+
+            /**
+             * @brief The loading state of the texture.
+             * @details A texture requested asynchronously stays pending, without pixels, until
+             *          the TextureCache commits its decoded image at a frame boundary.
+             * @sharedapi
+             */
+            TextureState State() const { return state; }
+
+        private:
+            friend class TextureCache;
+
+            TextureState state {TextureState::ready};
+            std::string path;
+            int width;
+            int height;
+            std::vector<std::uint32_t> pixels;
+            std::vector<std::vector<std::uint32_t>> mipLevels;
+
+#if __has_include("Texture_private.hpp")
+#include "Texture_private.hpp"
+#endif
+    };
+
+}
+
+#endif // TEXTURE_H_
@@ -0,0 +1,175 @@
+#ifndef TEXTUREATLAS_H_
+#define TEXTUREATLAS_H_
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if __has_include("TextureAtlas_includes.hpp")
+#include "TextureAtlas_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief The location of a packed image inside a texture atlas.
+     * @sharedapi
+     */
+    struct AtlasRegion {
+        std::size_t page; // Index of the page the image was packed in
+        int x; // Left edge on the page, in pixels
+        int y; // Top edge on the page, in pixels
+        int width; // Width of the image, in pixels
+        int height; // Height of the image, in pixels
+        double u0; // Left edge as texture coordinate, 0 ≤ u0 ≤ 1
+        double v0; // Top edge as texture coordinate, 0 ≤ v0 ≤ 1
+        double u1; // Right edge as texture coordinate, 0 ≤ u1 ≤ 1
+        double v1; // Bottom edge as texture coordinate, 0 ≤ v1 ≤ 1
+    };
+
+    /**
+     * @brief Packs many small images into a few large pages, with a lookup from the
+     *        original image path to the page and region it was packed in.
+     * @details An atlas can be built offline and saved, or built while loading a scene.
+     *          After registering it with Renderer::RegisterAtlas(), sprites whose texture
+     *          path is in the atlas are drawn from the atlas page instead.
+     * @sharedapi
+     */
+    class TextureAtlas {
+        public:
+            /**
+             * @brief Constructor.
+             * @param pageWidth The width of each page in pixels.
+             * @param pageHeight The height of each page in pixels.
+             * @param padding The amount of pixels kept free around every image.
+             * @sharedapi
+             */
+            TextureAtlas(int pageWidth, int pageHeight, int padding = 1);
+
+            /**
+             * @brief Load an atlas which was saved earlier.
+             * @param file The atlas description written by Save().
+             * @return The loaded atlas.
+             * @exception A std::runtime_error is thrown when the file or one of its pages cannot be read.
+             * @sharedapi
+             */
+            static TextureAtlas Load(const std::string& file);
+
+            /**
+             * @brief Save the pages and the lookup table of the atlas.
+             * @details The pages are written as images next to the description file.
+             * @param file The file to write the atlas description to.
+             * @exception A std::logic_error is thrown when the atlas has not been packed.
+             * @sharedapi
+             */
+            void Save(const std::string& file) const;
+
+            /**
+             * @brief Add an image to be packed.
+             * @param path The path of the image, as used by Sprite::Texture().
+             * @sharedapi
+             */
+            void Add(const std::string& path);
+
+            /**
+             * @brief Add a list of images to be packed, e.g. the frames of an animation.
+             * @param paths The paths of the images.
+             * @sharedapi
+             */
+            void Add(const std::vector<std::string>& paths);
+
+            /**
+             * @brief Pack all added images into as few pages as possible.
+             * @exception A std::runtime_error is thrown when an image cannot be read or
+             *            does not fit on an empty page.
+             * @sharedapi
+             */
+            void Pack();
+
+            /**
+             * @brief Look up where an image was packed.
+             * @param path The original path of the image.
+             * @return Pointer to the region, or nullptr if the image is not in the atlas.
+             * @sharedapi
+             */
+            const AtlasRegion* Find(const std::string& path) const;
+
+            /**
+             * @brief The amount of pages in the atlas.
+             * @sharedapi
+             */
+            std::size_t PageCount() const { return pages.size(); }
+
+            /**
+             * @brief The path of a page image, used to load it as a texture.
+             * @details For an atlas packed in memory and not saved, this is a generated path
+             *          which only resolves after RegisterPages().
+             * @param page The index of the page.
+             * @return The path of the page image.
+             * @sharedapi
+             */
+            const std::string& PagePath(std::size_t page) const { return pages.at(page); }
+
+            /**
+             * @brief Add the pages packed in memory to the TextureCache under their PagePath(),
+             *        so an atlas which was never saved can be drawn from.
+             * @details The pages stay resident until UnregisterPages() is called. They get at most
+             *          MipLevels() prescaled levels, the amount that is safe for the padding.
+             * @exception A std::logic_error is thrown when the atlas has not been packed in
+             *            memory, e.g. because it was loaded from a file.
+             * @sharedapi
+             */
+            void RegisterPages() const;
+
+            /**
+             * @brief Remove the pages added by RegisterPages() from the TextureCache.
+             * @sharedapi
+             */
+            void UnregisterPages() const;
+
+            /**
+             * @brief The width of each page in pixels.
+             * @sharedapi
+             */
+            int PageWidth() const { return pageWidth; }
+
+            /**
+             * @brief The height of each page in pixels.
+             * @sharedapi
+             */
+            int PageHeight() const { return pageHeight; }
+
+            /**
+             * @brief The amount of prescaled levels generated for each page.
+             * @sharedapi
+             */
+            int MipLevels() const { return mipLevels; }
+
+            /**
+             * @brief Set the amount of prescaled levels generated for each page when packing.
+             * @details The padding must be at least 2 to the power of the amount of levels,
+             *          so neighbouring images do not bleed into each other at the lowest level.
+             * @param levels The amount of levels, 0 to only keep the full resolution pages.
+             * @exception A std::invalid_argument is thrown when the padding is too small.
+             * @sharedapi
+             */
+            void MipLevels(int levels);
+
+        private:
+            int pageWidth;
+            int pageHeight;
+            int padding;
+            int mipLevels {0};
+            std::vector<std::string> pending;
+            std::vector<std::string> pages;
+            std::unordered_map<std::string, AtlasRegion> regions;
+
+#if __has_include("TextureAtlas_private.hpp")
+#include "TextureAtlas_private.hpp"
+#endif
+    };
+
+}
+
+#endif // TEXTUREATLAS_H_
@@ -0,0 +1,204 @@
+#ifndef TEXTURECACHE_H_
+#define TEXTURECACHE_H_
+
+#include "Texture.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if __has_include("TextureCache_includes.hpp")
+#include "TextureCache_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief Counters describing the state of the texture cache.
+     * @sharedapi
+     */
+    struct TextureCacheStats {
+        std::size_t hits; // Acquires served from the cache
+        std::size_t misses; // Acquires which had to decode the image
+        std::size_t evictions; // Textures evicted to stay within the budget
+        std::size_t residentTextures; // Textures currently decoded
+        std::size_t residentBytes; // Memory used by the decoded textures
+
+        /**
+         * @brief The fraction of acquires served from the cache.
+         * @return A value between 0.0 and 1.0, 0.0 when nothing was acquired yet.
+         * @sharedapi
+         */
+        double HitRate() const { return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses); }
+    };
+
+    /**
+     * @brief Cache which decodes every texture path only once and shares the result.
+     * @details Texture paths are interned to a stable ID. A texture stays in memory while
+     *          it is referenced; unreferenced textures are evicted in least recently used
+     *          order whenever the resident bytes exceed the budget from the RenderConfig.
+     *          Textures can also be requested asynchronously, in which case they are decoded
+     *          on the JobSystem and committed at the next frame boundary.
+     * @sharedapi
+     */
+    class TextureCache {
+        private:
+            static TextureCache instance;
+            TextureCache();
+
+#if __has_include("TextureCache_private.hpp")
+#include "TextureCache_private.hpp"
+#endif
+
+        public:
+            static TextureCache& Instance();
+            TextureCache(const TextureCache&) = delete;
+            TextureCache& operator=(const TextureCache&) = delete;
+            TextureCache(const TextureCache&&) = delete;
+            TextureCache& operator=(TextureCache&&) = delete;
+
+            /**
+             * @brief Get the ID of a texture path, without decoding it.
+             * @param path The path of the texture.
+             * @return The ID, the same for every call with an equal path.
+             * @sharedapi
+             */
+            std::uint32_t Intern(const std::string& path);
+
+            /**
+             * @brief Get the path an ID was interned from.
+             * @param id The ID returned by Intern().
+             * @return The path of the texture.
+             * @exception A std::out_of_range is thrown when the ID is unknown.
+             * @sharedapi
+             */
+            const std::string& Path(std::uint32_t id) const;
+
+            /**
+             * @brief Get a texture, decoding it if it is not resident.
+             * @param path The path of the texture.
+             * @return A reference counted pointer to the texture. The texture is not
+             *         evicted while the pointer is held.
+             * @exception A std::runtime_error is thrown when the image cannot be decoded.
+             * @sharedapi
+             */
+            std::shared_ptr<const Texture> Acquire(const std::string& path);
+
+            /**
+             * @brief Get a texture by its interned ID, decoding it if it is not resident.
+             * @param id The ID returned by Intern().
+             * @return A reference counted pointer to the texture.
+             * @exception A std::runtime_error is thrown when the image cannot be decoded.
+             * @sharedapi
+             */
+            std::shared_ptr<const Texture> Acquire(std::uint32_t id);
+
+            /**
+             * @brief Add a texture created in memory, e.g. an atlas page packed at load time.
+             * @details The path is interned like any other. Since the texture cannot be decoded
+             *          again, it is never evicted until Remove() is called.
+             * @param path The path to add the texture under; replaces a texture with the same path.
+             * @param width The width in pixels.
+             * @param height The height in pixels.
+             * @param pixels The pixels, width * height values.
+             * @param mipLevels The maximum amount of prescaled levels to generate, further limited
+             *        by RenderConfig::maxMipLevels. Atlas pages pass TextureAtlas::MipLevels(), so
+             *        neighbouring images do not bleed into each other at the lowest level.
+             * @return The ID of the path.
+             * @sharedapi
+             */
+            std::uint32_t Insert(const std::string& path, int width, int height, std::vector<std::uint32_t> pixels, int mipLevels);
+
+            /**
+             * @brief Remove a texture added with Insert(), so it is evicted once it is no longer referenced.
+             * @param path The path the texture was added under.
+             * @sharedapi
+             */
+            void Remove(const std::string& path);
+
+            /**
+             * @brief Get a texture without waiting for it to be decoded.
+             * @details If the texture is not resident, a pending texture is returned and the
+             *          image is decoded on a worker thread. Sprites using a pending texture are
+             *          drawn with the Placeholder() until it is committed.
+             * @param path The path of the texture.
+             * @return A reference counted pointer to the texture, which may still be pending.
+             * @sharedapi
+             */
+            std::shared_ptr<const Texture> Request(const std::string& path);
+
+            /**
+             * @brief Request a list of textures, e.g. for a loading screen.
+             * @details Like any texture, a preloaded texture can be evicted once it is no longer
+             *          referenced, so keep the returned pointers until the textures are in use.
+             * @param paths The paths of the textures.
+             * @return A reference counted pointer per path, in the same order, which may still be pending.
+             * @sharedapi
+             */
+            std::vector<std::shared_ptr<const Texture>> Preload(const std::vector<std::string>& paths);
+
+            /**
+             * @brief Commit the textures which finished decoding, making them ready.
+             * @details Called by the engine at the start of every frame, so a texture never
+             *          changes state while a frame is being rendered.
+             * @sharedapi
+             */
+            void CommitPending();
+
+            /**
+             * @brief Wait until all requested textures are decoded, then commit them.
+             * @sharedapi
+             */
+            void WaitForPending();
+
+            /**
+             * @brief The amount of requested textures which are not committed yet.
+             * @sharedapi
+             */
+            std::size_t PendingCount() const;
+
+            /**
+             * @brief The texture drawn in place of pending or failed textures.
+             * @sharedapi
+             */
+            const Texture& Placeholder() const;
+
+            /**
+             * @brief Get the memory budget for resident textures.
+             * @return The budget in bytes
+             * @sharedapi
+             */
+            std::size_t Budget() const;
+
+            /**
+             * @brief Set the memory budget for resident textures and evict to stay within it.
+             * @param bytes The new budget in bytes
+             * @sharedapi
+             */
+            void Budget(std::size_t bytes);
+
+            /**
+             * @brief Evict unreferenced textures, least recently used first, until the
+             *        resident bytes are within the budget.
+             * @sharedapi
+             */
+            void Trim();
+
+            /**
+             * @brief Evict all unreferenced textures, e.g. when switching scenes.
+             * @sharedapi
+             */
+            void Clear();
+
+            /**
+             * @brief Get the counters of the cache.
+             * @return A copy of the current counters
+             * @sharedapi
+             */
+            TextureCacheStats Stats() const;
+    };
+
+}
+
+#endif // TEXTURECACHE_H_
@@ -0,0 +1,184 @@
+#ifndef TILEMAP_H_
+#define TILEMAP_H_
+
+#include "Bounds.hpp"
+#include "Component.hpp"
+#include "TextureAtlas.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if __has_include("Tilemap_includes.hpp")
+#include "Tilemap_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief A component rendering a grid of tiles, instead of one GameObject per tile.
+     * @details Tiles are stored as indices into a list of tile textures, which must all be
+     *          packed in the given atlas. The grid is rendered per chunk: every chunk is
+     *          baked once and only rebuilt when one of its tiles changes. Only chunks
+     *          overlapping the visible area of the camera are drawn.
+     * @sharedapi
+     */
+    class Tilemap : public Component {
+        public:
+            /**
+             * @brief The tile index of a cell without a tile.
+             * @sharedapi
+             */
+            static constexpr std::uint16_t emptyTile = 0xFFFF;
+
+            /**
+             * @brief Constructor. All cells start empty.
+             * @param atlas The atlas containing the tile textures.
+             * @param tileTextures The texture paths the tile indices refer to.
+             * @param columns The amount of columns in the grid.
+             * @param rows The amount of rows in the grid.
+             * @param tileWidth The width of a tile in world units.
+             * @param tileHeight The height of a tile in world units.
+             * @param sortingLayer The layer the tilemap will be sorted on.
+             * @param chunkSize The width and height of a chunk in tiles.
+             * @exception A std::invalid_argument is thrown when a tile texture is not in the atlas.
+             * @sharedapi
+             */
+            Tilemap(std::shared_ptr<const TextureAtlas> atlas, const std::vector<std::string>& tileTextures,
+                    int columns, int rows, double tileWidth, double tileHeight, int sortingLayer = 0, int chunkSize = 32);
+
+            /**
+             * @brief Get the tile of a cell
+             * @param column The column of the cell.
+             * @param row The row of the cell.
+             * @return The tile index, or emptyTile
+             * @exception A std::out_of_range is thrown when the cell is outside the grid.
+             * @sharedapi
+             */
+            std::uint16_t Tile(int column, int row) const;
+
+            /**
+             * @brief Set the tile of a cell, marking its chunk for rebuilding
+             * @param column The column of the cell.
+             * @param row The row of the cell.
+             * @param tile The tile index, or emptyTile to clear the cell
+             * @exception A std::out_of_range is thrown when the cell is outside the grid, or when
+             *            the tile is not emptyTile and not an index into the tile textures.
+             * @sharedapi
+             */
+            void Tile(int column, int row, std::uint16_t tile);
+
+            /**
+             * @brief Set every cell to the same tile, marking all chunks for rebuilding
+             * @param tile The tile index, or emptyTile to clear the grid
+             * @exception A std::out_of_range is thrown when the tile is not emptyTile and not an
+             *            index into the tile textures.
+             * @sharedapi
+             */
+            void Fill(std::uint16_t tile);
+
+            /**
+             * @brief Get if a tile blocks movement
+             * @param tile The tile index
+             * @return true if cells with this tile get a collider, false otherwise
+             * @exception A std::out_of_range is thrown when the tile is not an index into the tile textures.
+             * @sharedapi
+             */
+            bool Solid(std::uint16_t tile) const;
+
+            /**
+             * @brief Set if a tile blocks movement
+             * @param tile The tile index
+             * @param solid desired value
+             * @exception A std::out_of_range is thrown when the tile is not an index into the tile textures.
+             * @sharedapi
+             */
+            void Solid(std::uint16_t tile, bool solid);
+
+            /**
+             * @brief Get if a chunk has to be rebuilt before it is drawn again
+             * @param chunkColumn The column of the chunk.
+             * @param chunkRow The row of the chunk.
+             * @return true if one of its tiles changed since it was baked, false otherwise
+             * @sharedapi
+             */
+            bool ChunkDirty(int chunkColumn, int chunkRow) const;
+
+            /**
+             * @brief Merge the solid cells into as few rectangles as possible
+             * @return The rectangles, relative to the position of the GameObject
+             * @sharedapi
+             */
+            std::vector<Bounds> MergedCollisionBounds() const;
+
+            /**
+             * @brief Replace the colliders generated earlier with static BoxColliders
+             *        covering MergedCollisionBounds(), added as children of the GameObject
+             * @sharedapi
+             */
+            void GenerateColliders();
+
+            /**
+             * @brief The amount of columns in the grid
+             * @sharedapi
+             */
+            int Columns() const { return columns; }
+
+            /**
+             * @brief The amount of rows in the grid
+             * @sharedapi
+             */
+            int Rows() const { return rows; }
+
+            /**
+             * @brief The width of a tile in world units
+             * @sharedapi
+             */
+            double TileWidth() const { return tileWidth; }
+
+            /**
+             * @brief The height of a tile in world units
+             * @sharedapi
+             */
+            double TileHeight() const { return tileHeight; }
+
+            /**
+             * @brief The width and height of a chunk in tiles
+             * @sharedapi
+             */
+            int ChunkSize() const { return chunkSize; }
+
+            /**
+             * @brief The layer the tilemap will be sorted on
+             * @sharedapi
+             */
+            int SortingLayer() const { return sortingLayer; }
+
+            /**
+             * @brief The layer the tilemap will be sorted on
+             * @param newSortingLayer desired value
+             * @sharedapi
+             */
+            void SortingLayer(int newSortingLayer) { sortingLayer = newSortingLayer; }
+
+        private:
+            std::shared_ptr<const TextureAtlas> atlas;
+            std::vector<std::string> tileTextures;
+            int columns;
+            int rows;
+            double tileWidth;
+            double tileHeight;
+            int sortingLayer;
+            int chunkSize;
+            std::vector<std::uint16_t> tiles;
+            std::vector<bool> solid;
+            std::vector<bool> dirtyChunks;
+
+#if __has_include("Tilemap_private.hpp")
+#include "Tilemap_private.hpp"
+#endif
+    };
+
+}
+
+#endif // TILEMAP_H_
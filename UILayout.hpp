@@ -0,0 +1,42 @@
+#ifndef UILAYOUT_H_
+#define UILAYOUT_H_
+
+#include "Scene.hpp"
+#include <cstddef>
+
+#if __has_include("UILayout_includes.hpp")
+#include "UILayout_includes.hpp"
+#endif
+
+namespace spic {
+
+    /**
+     * @brief The retained layout pass for UIObject hierarchies.
+     * @sharedapi
+     */
+    namespace UILayout {
+
+        /**
+         * @brief Recompute the layout rectangles of the UIObjects in a scene.
+         * @details Called by the engine once per frame, before rendering. Only subtrees whose
+         *          root has an invalidated layout are visited; all other UIObjects keep their
+         *          cached LayoutRect().
+         * @param scene The scene to lay out.
+         * @sharedapi
+         */
+        void Update(Scene& scene);
+
+        /**
+         * @brief The amount of UIObjects whose rectangle was recomputed by the last Update().
+         * @sharedapi
+         */
+        std::size_t LastUpdateCount();
+
+#if __has_include("UILayout_public.hpp")
+#include "UILayout_public.hpp"
+#endif
+    }
+
+}
+
+#endif // UILAYOUT_H_
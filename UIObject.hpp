@@ -1,7 +1,9 @@
 #ifndef UIOBJECT_H_
 #define UIOBJECT_H_
 
+#include "Bounds.hpp"
 #include "GameObject.hpp"
+#include "Point.hpp"
 
 #if __has_include("UIObject_includes.hpp")
 #include "UIObject_includes.hpp"
@@ -35,6 +37,7 @@ namespace spic {
 
             /**
              * @brief Set the width of the UIObject
+             * @details Invalidates the layout of the UIObject and its children.
              * @param newWidth The new width of the UIObject
              * @sharedapi
              */
@@ -49,14 +52,70 @@ namespace spic {
 
             /**
              * @brief Set the height of the UIObject
+             * @details Invalidates the layout of the UIObject and its children.
              * @param newHeight The new height of the UIObject
              * @sharedapi
              */
             void Height(double newHeight);
 
+            /**
+             * @brief Get the point of the parent rectangle the UIObject is attached to
+             * @return The anchor, from (0, 0) for the top-left to (1, 1) for the bottom-right corner
+             * @sharedapi
+             */
+            const Point& Anchor() const { return anchor; }
+
+            /**
+             * @brief Set the point of the parent rectangle the UIObject is attached to
+             * @details The transform position is the offset from this point. Invalidates the
+             *          layout of the UIObject and its children.
+             * @param newAnchor The new anchor, from (0, 0) to (1, 1)
+             * @sharedapi
+             */
+            void Anchor(const Point& newAnchor);
+
+            /**
+             * @brief Get the point of the UIObject placed on the anchor
+             * @return The pivot, from (0, 0) for the top-left to (1, 1) for the bottom-right corner
+             * @sharedapi
+             */
+            const Point& Pivot() const { return pivot; }
+
+            /**
+             * @brief Set the point of the UIObject placed on the anchor, e.g. (0.5, 0.5) to center it
+             * @details Invalidates the layout of the UIObject and its children.
+             * @param newPivot The new pivot, from (0, 0) to (1, 1)
+             * @sharedapi
+             */
+            void Pivot(const Point& newPivot);
+
+            /**
+             * @brief Get the rectangle computed by the last layout pass
+             * @return The rectangle in screen space
+             * @sharedapi
+             */
+            const Bounds& LayoutRect() const { return layoutRect; }
+
+            /**
+             * @brief Mark the layout of the UIObject and its children for recomputation
+             * @sharedapi
+             */
+            void InvalidateLayout();
+
+            /**
+             * @brief Get if the layout has to be recomputed by the next layout pass
+             * @return true if invalidated since the last pass, false otherwise
+             * @sharedapi
+             */
+            bool LayoutDirty() const { return layoutDirty; }
+
         private:
             double width;
             double height;
+            Point anchor {0.0, 0.0};
+            Point pivot {0.0, 0.0};
+            Bounds layoutRect {};
+            bool layoutDirty {true};
 
 #if __has_include("UIObject_private.hpp")
 #include "UIObject_private.hpp"
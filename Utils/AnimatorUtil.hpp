@@ -1,6 +1,7 @@
 #ifndef SPIC_ANIMATORUTIL_HPP
 #define SPIC_ANIMATORUTIL_HPP
 
+#include "AnimationClip.hpp"
 #include "Sprite.hpp"
 
 #include <memory>
@@ -46,6 +47,27 @@ namespace spic
              * @return A list of sprites.
              */
             static types::sprite_vector CreateSpriteVector(int max, const std::string& prefix, spic::Color color, int sortingLayer = 0, const std::string& extension = ".png", bool flipX = false, bool flipY = false, int orderLayer = 0);
+
+            /**
+             * @brief Create a clip to share between animators by a given file template.
+             * @param fps The amount of frames per second of the clip.
+             * @param max The amount of sprites.
+             * @param prefix The path to put in front of the index.
+             * @param extension The file extension to place after the prefix and index.
+             * @param flipX Whether to flip the frames on the X-axis.
+             * @param flipY Whether to flip the frames on the Y-axis.
+             * @return A clip.
+             */
+            static std::shared_ptr<const spic::AnimationClip> CreateClip(int fps, int max, const std::string& prefix, const std::string& extension = ".png", bool flipX = false, bool flipY = false);
+
+            /**
+             * @brief Create the list of file paths used by CreateSpriteVector, e.g. to add them to a TextureAtlas.
+             * @param max The amount of paths.
+             * @param prefix The path to put in front of the index.
+             * @param extension The file extension to place after the prefix and index.
+             * @return A list of paths.
+             */
+            static std::vector<std::string> CreatePathVector(int max, const std::string& prefix, const std::string& extension = ".png");
     };
 }
 
@@ -0,0 +1,54 @@
+#ifndef SPIC_COLORUTIL_HPP
+#define SPIC_COLORUTIL_HPP
+
+#include "Color.hpp"
+#include "Span.hpp"
+
+namespace spic
+{
+    /**
+     * @brief A util for converting many colors between representations at once.
+     * @details The conversions use SIMD instructions where the platform supports them.
+     *          The input and output spans must have the same size.
+     */
+    class ColorUtil
+    {
+        public:
+            /**
+             * @brief Pack colors into 8 bits per channel, clamping and rounding every channel.
+             * @param colors The colors to pack.
+             * @param packed The span to write the packed colors to.
+             */
+            static void Pack(Span<const spic::Color> colors, Span<spic::Color32> packed);
+
+            /**
+             * @brief Unpack colors stored with 8 bits per channel.
+             * @param packed The packed colors.
+             * @param colors The span to write the colors to.
+             */
+            static void Unpack(Span<const spic::Color32> packed, Span<spic::Color> colors);
+
+            /**
+             * @brief Convert colors to half-precision floats.
+             * @param colors The colors to convert.
+             * @param half The span to write the converted colors to.
+             */
+            static void ToHalf(Span<const spic::Color> colors, Span<spic::ColorHalf> half);
+
+            /**
+             * @brief Convert colors stored as half-precision floats.
+             * @param half The colors to convert.
+             * @param colors The span to write the converted colors to.
+             */
+            static void FromHalf(Span<const spic::ColorHalf> half, Span<spic::Color> colors);
+
+            /**
+             * @brief Convert packed colors to half-precision floats, without a detour through doubles.
+             * @param packed The packed colors.
+             * @param half The span to write the converted colors to.
+             */
+            static void ToHalf(Span<const spic::Color32> packed, Span<spic::ColorHalf> half);
+    };
+}
+
+#endif //SPIC_COLORUTIL_HPP